@@ -354,6 +354,182 @@ class uDynamicHeap : public uGenericHeap<KeyType, DataType, uDynamicHeapArray> {
 }; // uHeap
 
 
+// Policies for uDaryHeap are classes with static members, so comparisons and moves are resolved at compile time and
+// inlined rather than called through function pointers. Before::before( x, y ) is true when key x belongs above key y.
+// Moved::moved( elem, i ) is called whenever an element is stored at subscript i, so elements can record their position
+// for removal.
+
+template<typename KeyType> struct uHeapMin {		// smallest key at the root
+    static bool before( const KeyType &x, const KeyType &y ) { return x < y; }
+}; // uHeapMin
+
+template<typename KeyType> struct uHeapMax {		// largest key at the root
+    static bool before( const KeyType &x, const KeyType &y ) { return y < x; }
+}; // uHeapMax
+
+struct uHeapUnindexed {					// elements do not track their position
+    template<typename Elt> static void moved( Elt &, int ) {}
+}; // uHeapUnindexed
+
+
+// A d-ary heap keeps the children of a node contiguous, so a sift down scans one or two cache lines per level, and the
+// tree is log2(Arity) times shallower than a binary heap. Elements move into a hole rather than being exchanged, halving
+// the stores per level. Valid subscripts are 1..size(), as for uGenericHeap, and the children of i are
+// Arity * (i - 1) + 2 .. Arity * i + 1.
+
+template<typename KeyType, typename DataType, template<typename Elt> class Array, typename Before = uHeapMin<KeyType>, typename Moved = uHeapUnindexed, int Arity = 4>
+class uDaryHeap {
+    static_assert( Arity >= 2, "uDaryHeap arity must be at least 2" );
+    typedef uHeapable<KeyType,DataType> Elt;
+
+    int heapSize;
+
+    static int parent( int i ) {
+	return (i - 2) / Arity + 1;
+    } // uDaryHeap::parent
+
+    static int child( int i ) {				// first child
+	return Arity * (i - 1) + 2;
+    } // uDaryHeap::child
+
+    void place( int i, Elt elem ) {			// copy as a dynamic array may move on access
+	A[i] = elem;
+	Moved::moved( A[i], i );
+    } // uDaryHeap::place
+
+    void siftUp( int i, Elt elem ) {			// fill hole at i with elem, moving ancestors down
+	while ( i > 1 ) {
+	    int p = parent( i );
+	  if ( ! Before::before( elem.key, A[p].key ) ) break;
+	    place( i, A[p] );
+	    i = p;
+	} // while
+	place( i, elem );
+    } // uDaryHeap::siftUp
+
+    void siftDown( int i, Elt elem ) {			// fill hole at i with elem, moving descendants up
+	for ( ;; ) {
+	    int first = child( i );
+	  if ( first > heapSize ) break;
+	    int last = first + Arity - 1 < heapSize ? first + Arity - 1 : heapSize, best = first;
+	    for ( int c = first + 1; c <= last; c += 1 ) {
+		if ( Before::before( A[c].key, A[best].key ) ) best = c;
+	    } // for
+	  if ( ! Before::before( A[best].key, elem.key ) ) break;
+	    place( i, A[best] );
+	    i = best;
+	} // for
+	place( i, elem );
+    } // uDaryHeap::siftDown
+
+    void resift( int i, Elt elem ) {			// fill hole at i with elem, moving in either direction
+	if ( i > 1 && Before::before( elem.key, A[parent( i )].key ) ) {
+	    siftUp( i, elem );
+	} else {
+	    siftDown( i, elem );
+	} // if
+    } // uDaryHeap::resift
+  public:
+    Array<Elt> A;					// do not use A[0], valid subscripts are 1..size()
+
+    uDaryHeap() : heapSize( 0 ) {}
+    uDaryHeap( int size ) : heapSize( 0 ), A( size ) {}
+
+    int size() const {					// heap size
+	return heapSize;
+    } // uDaryHeap::size
+
+    bool empty() const {
+	return heapSize == 0;
+    } // uDaryHeap::empty
+
+    const Elt &root() const {
+#ifdef __U_DEBUG__
+	assert( heapSize > 0 );
+#endif // __U_DEBUG__
+	return A[1];
+    } // uDaryHeap::root
+
+    void getRoot( Elt &root ) const {
+	root = uDaryHeap::root();
+    } // uDaryHeap::getRoot
+
+    void insert( KeyType key, DataType data ) {		// insert element into heap
+	heapSize += 1;
+	siftUp( heapSize, Elt( key, data ) );
+    } // uDaryHeap::insert
+
+    void insert_last( KeyType key, DataType data ) {	// append without ordering, followed by buildHeap
+	heapSize += 1;
+	place( heapSize, Elt( key, data ) );
+    } // uDaryHeap::insert_last
+
+    void deleteInsert( KeyType key, DataType data ) {	// replace root element
+#ifdef __U_DEBUG__
+	assert( heapSize > 0 );
+#endif // __U_DEBUG__
+	siftDown( 1, Elt( key, data ) );
+    } // uDaryHeap::deleteInsert
+
+    void remove( int i ) {				// remove element at subscript i
+#ifdef __U_DEBUG__
+	assert( 0 < i && i <= heapSize );
+#endif // __U_DEBUG__
+	Elt last = A[heapSize];
+	heapSize -= 1;
+      if ( i > heapSize ) return;			// removed last element ?
+	resift( i, last );
+    } // uDaryHeap::remove
+
+    void deleteRoot() {					// remove root element
+	remove( 1 );
+    } // uDaryHeap::deleteRoot
+
+    void update( int i, KeyType key ) {			// change key of element at subscript i
+#ifdef __U_DEBUG__
+	assert( 0 < i && i <= heapSize );
+#endif // __U_DEBUG__
+	Elt elem = A[i];
+	elem.key = key;
+	resift( i, elem );
+    } // uDaryHeap::update
+
+    void buildHeap() {					// bottom-up heapify of all elements in O(n)
+      if ( heapSize < 2 ) return;
+	for ( int i = parent( heapSize ); i >= 1; i -= 1 ) {
+	    siftDown( i, A[i] );
+	} // for
+    } // uDaryHeap::buildHeap
+
+    // Move all elements of other into this heap, leaving other empty. A small heap is inserted element by element;
+    // otherwise the elements are appended and the combined heap is rebuilt in linear time.
+
+    void merge( uDaryHeap &other ) {
+	if ( other.heapSize * 8 < heapSize ) {
+	    for ( int i = 1; i <= other.heapSize; i += 1 ) insert( other.A[i].key, other.A[i].data );
+	} else {
+	    for ( int i = 1; i <= other.heapSize; i += 1 ) insert_last( other.A[i].key, other.A[i].data );
+	    buildHeap();
+	} // if
+	other.heapSize = 0;
+    } // uDaryHeap::merge
+}; // uDaryHeap
+
+
+template<typename KeyType, typename DataType, int MaxSize, typename Before = uHeapMin<KeyType>, typename Moved = uHeapUnindexed, int Arity = 4>
+class uStaticDaryHeap : public uDaryHeap<KeyType, DataType, uStaticHeapArray<MaxSize>::template ArrayType, Before, Moved, Arity> {
+}; // uStaticDaryHeap
+
+
+template<typename KeyType, typename DataType, typename Before = uHeapMin<KeyType>, typename Moved = uHeapUnindexed, int Arity = 4>
+class uDynamicDaryHeap : public uDaryHeap<KeyType, DataType, uDynamicHeapArray, Before, Moved, Arity> {
+    typedef uDaryHeap<KeyType, DataType, uDynamicHeapArray, Before, Moved, Arity> Base;
+  public:
+    uDynamicDaryHeap() {}
+    uDynamicDaryHeap( int size ) : Base( size ) {}
+}; // uDynamicDaryHeap
+
+
 template<typename KeyType, typename DataType, int MaxSize> class uHeapPtrSort {
   public:
     uHeapPtrSort( uHeap<KeyType,DataType,MaxSize> *h, DataType DataRecords, DataType tempRecPtr ) {
@@ -0,0 +1,210 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// uRingBuffer.h -- Generic bounded buffer using a lock-free multi-producer/multi-consumer ring
+//
+// Author           :
+// Created On       : Sun Oct 18 13:40:26 2026
+// Last Modified By :
+// Last Modified On : Sun Oct 18 13:40:26 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+
+#pragma once
+
+
+// Each slot has a sequence number giving the insert or remove position it is ready for, so producers and consumers
+// claim positions with a compare-and-assign on separate counters and never take a lock. A task blocks only when the
+// buffer is full or empty: it registers as waiting under a lock and rechecks the buffer before waiting, and the other
+// side signals only when it sees a registered waiter, so the uncontended path never enters the kernel.
+
+template<typename ElemType> class uRingBuffer {
+    enum { CacheLine = 64 };
+
+    struct alignas(CacheLine) Slot {
+	size_t seq;					// position this slot is ready for
+	ElemType elem;
+    }; // Slot
+
+    struct alignas(CacheLine) Side {			// producer or consumer state, one per cache line
+	size_t pos;					// next position to claim
+	unsigned int waiting;				// tasks blocked on this side
+	uOwnerLock lock;
+	uCondLock blocked;
+    }; // Side
+
+    const size_t mask;					// capacity - 1, capacity is a power of 2
+    Slot *slots;
+    Side back, front;					// insert and remove
+
+    // Claim up to n consecutive positions from side, where a slot at position p is ready when its sequence number is
+    // p + offset. Return the first position claimed and the number claimed, which is 0 if the first slot is not ready.
+
+    size_t claim( Side &side, size_t offset, size_t n, size_t &first ) {
+	size_t pos = __atomic_load_n( &side.pos, __ATOMIC_RELAXED );
+	for ( ;; ) {
+	    size_t k;
+	    for ( k = 0; k < n && k <= mask; k += 1 ) {	// count ready slots
+		Slot &slot = slots[(pos + k) & mask];
+	      if ( __atomic_load_n( &slot.seq, __ATOMIC_ACQUIRE ) != pos + k + offset ) break;
+	    } // for
+	    if ( k == 0 ) {
+		Slot &slot = slots[pos & mask];
+		ssize_t diff = (ssize_t)(__atomic_load_n( &slot.seq, __ATOMIC_ACQUIRE ) - (pos + offset));
+	      if ( diff < 0 ) return 0;			// full or empty
+		pos = __atomic_load_n( &side.pos, __ATOMIC_RELAXED ); // another task claimed pos
+		continue;
+	    } // if
+	  if ( __atomic_compare_exchange_n( &side.pos, &pos, pos + k, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED ) ) {
+		first = pos;
+		return k;
+	    } // exit
+	} // for
+    } // uRingBuffer::claim
+
+    // Wake waiters on side after the other side changed the buffer. The fence orders the slot updates before the
+    // check of waiting, pairing with the waiter incrementing waiting before rechecking the buffer.
+
+    void wake( Side &side, size_t n ) {
+	__atomic_thread_fence( __ATOMIC_SEQ_CST );
+      if ( __atomic_load_n( &side.waiting, __ATOMIC_RELAXED ) == 0 ) return;
+	side.lock.acquire();
+	if ( n == 1 ) side.blocked.signal();
+	else side.blocked.broadcast();
+	side.lock.release();
+    } // uRingBuffer::wake
+
+    size_t put( const ElemType elems[], size_t n ) {
+	size_t first, k = claim( back, 0, n, first );
+	for ( size_t i = 0; i < k; i += 1 ) {
+	    Slot &slot = slots[(first + i) & mask];
+	    slot.elem = elems[i];
+	    __atomic_store_n( &slot.seq, first + i + 1, __ATOMIC_RELEASE ); // ready for removal
+	} // for
+	return k;
+    } // uRingBuffer::put
+
+    size_t take( ElemType elems[], size_t n ) {
+	size_t first, k = claim( front, 1, n, first );
+	for ( size_t i = 0; i < k; i += 1 ) {
+	    Slot &slot = slots[(first + i) & mask];
+	    elems[i] = slot.elem;
+	    __atomic_store_n( &slot.seq, first + i + mask + 1, __ATOMIC_RELEASE ); // ready for next lap insertion
+	} // for
+	return k;
+    } // uRingBuffer::take
+
+    // Block on side until at least one element is transferred. The other side is woken after the lock is released, so
+    // the two locks are never held together.
+
+    template<typename Buf> size_t park( Side &side, Buf elems, size_t n, size_t (uRingBuffer::*op)( Buf, size_t ) ) {
+	side.lock.acquire();
+	__atomic_fetch_add( &side.waiting, 1, __ATOMIC_SEQ_CST );
+	size_t k;
+	while ( (k = (this->*op)( elems, n )) == 0 ) {
+	    side.blocked.wait( side.lock );
+	} // while
+	__atomic_fetch_sub( &side.waiting, 1, __ATOMIC_SEQ_CST );
+	side.lock.release();
+	return k;
+    } // uRingBuffer::park
+
+    size_t doInsert( const ElemType elems[], size_t n, bool block ) {
+	size_t k = put( elems, n );
+	if ( k == 0 && block ) k = park( back, elems, n, &uRingBuffer::put );
+	if ( k != 0 ) wake( front, k );
+	return k;
+    } // uRingBuffer::doInsert
+
+    size_t doRemove( ElemType elems[], size_t n, bool block ) {
+	size_t k = take( elems, n );
+	if ( k == 0 && block ) k = park( front, elems, n, &uRingBuffer::take );
+	if ( k != 0 ) wake( back, k );
+	return k;
+    } // uRingBuffer::doRemove
+
+    static size_t pow2( size_t n ) {
+	size_t p = 1;
+	while ( p < n ) p <<= 1;
+	return p;
+    } // uRingBuffer::pow2
+  public:
+    uRingBuffer( const uRingBuffer & ) = delete;	// no copy
+    uRingBuffer( uRingBuffer && ) = delete;
+    uRingBuffer &operator=( const uRingBuffer & ) = delete; // no assignment
+
+    uRingBuffer( const size_t size = 1024 ) : mask( pow2( size ) - 1 ) { // capacity rounded up to a power of 2
+	slots = new Slot[mask + 1];
+	for ( size_t i = 0; i <= mask; i += 1 ) {
+	    slots[i].seq = i;				// ready for first lap insertion
+	} // for
+	back.pos = front.pos = 0;
+	back.waiting = front.waiting = 0;
+    } // uRingBuffer::uRingBuffer
+
+    ~uRingBuffer() {
+	delete [] slots;
+    } // uRingBuffer::~uRingBuffer
+
+    size_t capacity() const {
+	return mask + 1;
+    } // uRingBuffer::capacity
+
+    size_t query() const {				// approximate when the buffer is in use
+	return __atomic_load_n( &back.pos, __ATOMIC_RELAXED ) - __atomic_load_n( &front.pos, __ATOMIC_RELAXED );
+    } // uRingBuffer::query
+
+    bool tryInsert( const ElemType &elem ) {
+	return doInsert( &elem, 1, false ) == 1;
+    } // uRingBuffer::tryInsert
+
+    bool tryRemove( ElemType &elem ) {
+	return doRemove( &elem, 1, false ) == 1;
+    } // uRingBuffer::tryRemove
+
+    size_t tryInsert( const ElemType elems[], size_t n ) { // return number inserted
+	return doInsert( elems, n, false );
+    } // uRingBuffer::tryInsert
+
+    size_t tryRemove( ElemType elems[], size_t n ) {	// return number removed
+	return doRemove( elems, n, false );
+    } // uRingBuffer::tryRemove
+
+    void insert( const ElemType &elem ) {
+	doInsert( &elem, 1, true );
+    } // uRingBuffer::insert
+
+    ElemType remove() {
+	ElemType elem;
+	doRemove( &elem, 1, true );
+	return elem;
+    } // uRingBuffer::remove
+
+    void insert( const ElemType elems[], size_t n ) {	// block until all inserted
+	for ( size_t i = 0; i < n; i += doInsert( elems + i, n - i, true ) );
+    } // uRingBuffer::insert
+
+    size_t remove( ElemType elems[], size_t n ) {	// block until at least one removed, return number removed
+	return doRemove( elems, n, true );
+    } // uRingBuffer::remove
+}; // uRingBuffer
+
+
+// Local Variables: //
+// compile-command: "make install" //
+// End: //
@@ -0,0 +1,116 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// ActorDispatch.cc -- Actor routing typed messages through message-type tables, switching tables with become, and
+//     falling back to receive for untyped messages.
+//
+// Author           :
+// Created On       : Sun Oct 18 21:37:20 2026
+// Last Modified By :
+// Last Modified On : Sun Oct 18 21:37:20 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+#include <iostream>
+using namespace std;
+#include <uActor.h>
+
+struct AddMsg : public uActor::TypedMessage< AddMsg > {
+    int amount;
+    AddMsg( int amount ) : TypedMessage( uActor::Delete ), amount( amount ) {}
+}; // AddMsg
+
+struct SubMsg : public uActor::TypedMessage< SubMsg > {
+    int amount;
+    SubMsg( int amount ) : TypedMessage( uActor::Delete ), amount( amount ) {}
+}; // SubMsg
+
+struct GetMsg : public uActor::TypedMessage< GetMsg, uActor::FutureMessage< int > > {
+    GetMsg() : TypedMessage( uActor::Delete ) {}
+}; // GetMsg
+
+struct LockMsg : public uActor::TypedMessage< LockMsg > {} lockMsg;
+struct UnlockMsg : public uActor::TypedMessage< UnlockMsg > {} unlockMsg;
+struct PlainMsg : public uActor::Message {} plainMsg;	// untyped, handled by receive
+
+_Actor Counter {
+    int count = 0, rejected = 0, plain = 0;
+
+    Allocation add( AddMsg & msg ) { count += msg.amount; return Nodelete; }
+    Allocation sub( SubMsg & msg ) { count -= msg.amount; return Nodelete; }
+    Allocation get( GetMsg & msg ) { msg.delivery( count * 1000 + rejected * 10 + plain ); return Nodelete; }
+    Allocation stop( StopMsg & ) { return Delete; }
+
+    Allocation lock( LockMsg & ) {
+	static Dispatch locked( &Counter::unlock, &Counter::get, &Counter::stop, &Counter::reject );
+	become( locked );				// changes ignored until unlock
+	return Nodelete;
+    } // Counter::lock
+
+    Allocation unlock( UnlockMsg & ) {
+	become( unlocked() );
+	return Nodelete;
+    } // Counter::unlock
+
+    Allocation reject( Message & ) {			// otherwise handler while locked
+	rejected += 1;
+	return Nodelete;
+    } // Counter::reject
+
+    Allocation receive( Message & msg ) {		// otherwise handler while unlocked
+	Case( PlainMsg, msg ) {
+	    plain += 1;
+	} // Case
+	return Nodelete;
+    } // Counter::receive
+
+    static Dispatch & unlocked() {
+	static Dispatch dispatch( &Counter::add, &Counter::sub, &Counter::get, &Counter::lock, &Counter::stop );
+	return dispatch;
+    } // Counter::unlocked
+
+    void preStart() {
+	become( unlocked() );
+    } // Counter::preStart
+}; // Counter
+
+int main() {
+    enum { Adds = 100000 };
+    uActorStart();
+    Counter *counter = new Counter;
+
+    for ( int i = 0; i < Adds; i += 1 ) *counter | *new AddMsg( 2 ) | *new SubMsg( 1 );
+    *counter | plainMsg;
+    Future_ISM< int > before = *counter || *new GetMsg;
+    *counter | lockMsg | *new AddMsg( 5 ) | plainMsg | *new SubMsg( 5 ); // 3 rejected
+    Future_ISM< int > locked = *counter || *new GetMsg;
+    *counter | unlockMsg | *new AddMsg( 7 ) | plainMsg;
+    Future_ISM< int > after = *counter || *new GetMsg;
+    *counter | uActor::stopMsg;
+    uActorStop();
+
+    cout << "before " << before() << " locked " << locked() << " after " << after() << endl;
+    assert( before() == Adds * 1000 + 1 );
+    assert( locked() == Adds * 1000 + 30 + 1 );
+    assert( after() == ( Adds + 7 ) * 1000 + 30 + 2 );
+    assert( uActor::typeId< AddMsg >() != uActor::typeId< SubMsg >() );
+    cout << "successful completion" << endl;
+} // main
+
+// Local Variables: //
+// compile-command: "u++-work -g -O2 -multi ActorDispatch.cc" //
+// End: //
@@ -0,0 +1,99 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// ActorMailbox.cc -- Messages from several senders to actors with uneven work arrive in per-sender FIFO order while
+//     mailboxes are processed in batches and stolen by idle executor workers.
+//
+// Author           :
+// Created On       : Sun Oct 18 22:14:51 2026
+// Last Modified By :
+// Last Modified On : Sun Oct 18 22:14:51 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+#include <iostream>
+using namespace std;
+#include <uActor.h>
+
+enum { Senders = 4, Receivers = 32, Msgs = 2000 };
+
+struct SeqMsg : public uActor::Message {
+    unsigned int sender, seq;
+    SeqMsg( unsigned int sender, unsigned int seq ) : Message( uActor::Delete ), sender( sender ), seq( seq ) {}
+}; // SeqMsg
+
+unsigned int received = 0;
+
+_Actor Receiver {
+    unsigned int id, next[Senders] = {}, count = 0;
+
+    Allocation receive( Message & msg ) {
+	Case( SeqMsg, msg ) {
+	    assert( msg_d->seq == next[msg_d->sender] );	// FIFO per sender
+	    next[msg_d->sender] += 1;
+	    if ( id % 8 == 0 ) {			// uneven work, so other workers go idle and steal
+		for ( volatile int i = 0; i < 2000; i += 1 ) {}
+	    } // if
+	    count += 1;
+	    if ( count == Senders * Msgs ) {
+		uFetchAdd( received, count );
+		return Delete;
+	    } // if
+	} // Case
+	return Nodelete;
+    } // Receiver::receive
+  public:
+    Receiver( unsigned int id ) : id( id ) {}
+}; // Receiver
+
+_Task Sender {
+    unsigned int id;
+    Receiver ** receivers;
+
+    void main() {
+	for ( unsigned int s = 0; s < Msgs; s += 1 ) {
+	    for ( unsigned int r = 0; r < Receivers; r += 1 ) {
+		*receivers[r] | *new SeqMsg( id, s );
+	    } // for
+	} // for
+    } // Sender::main
+  public:
+    Sender( unsigned int id, Receiver ** receivers ) : id( id ), receivers( receivers ) {}
+}; // Sender
+
+int main() {
+    uProcessor processors[3];				// parallel senders and workers
+    Receiver * receivers[Receivers];
+
+    for ( unsigned int batch : { 1u, 4u, (unsigned int)uActor::DefaultBatch } ) {
+	received = 0;
+	uExecutor executor( 0, 4, 8, false, -1 );	// 4 workers over 8 queues
+	uActor::start( executor, batch );
+	for ( unsigned int r = 0; r < Receivers; r += 1 ) receivers[r] = new Receiver( r );
+	Sender * senders[Senders];
+	for ( unsigned int s = 0; s < Senders; s += 1 ) senders[s] = new Sender( s, receivers );
+	for ( unsigned int s = 0; s < Senders; s += 1 ) delete senders[s]; // wait for senders
+	uActor::stop();
+	assert( received == Senders * Receivers * Msgs );
+	cout << "batch " << batch << " received " << received << endl;
+    } // for
+    cout << "successful completion" << endl;
+} // main
+
+// Local Variables: //
+// compile-command: "u++-work -g -O2 -multi ActorMailbox.cc" //
+// End: //
@@ -0,0 +1,609 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// BenchSuite.cc -- Runtime micro-benchmarks with repetitions, percentiles and optional JSON output, for comparing
+//     performance across releases.
+//
+//     BenchSuite [ -p processors ] [ -r repetitions ] [ -n iterations ] [ -f name-filter ] [ -j ]
+//
+// Author           :
+// Created On       : Sun Oct 18 12:04:51 2026
+// Last Modified By :
+// Last Modified On : Sun Oct 18 12:04:51 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+#include <iostream>
+#include <iomanip>
+using std::cout;
+using std::cerr;
+using std::endl;
+#include <algorithm>					// sort
+#include <cstring>					// strstr
+#include <cstdlib>					// atoi, malloc, free
+#include <unistd.h>					// getopt, getpid, unlink
+#include <uAdaptiveLock.h>
+#include <uFuture.h>
+#include <uActor.h>
+#include <uSocket.h>
+#include <uFlexArray.h>
+#include <uHeap.h>
+
+unsigned int uDefaultPreemption() {
+    return 0;
+} // uDefaultPreemption
+
+#define STR( s ) #s
+#define XSTR( s ) STR( s )
+#define VERSION XSTR( __U_CPLUSPLUS__ ) "." XSTR( __U_CPLUSPLUS_MINOR__ ) "." XSTR( __U_CPLUSPLUS_PATCH__ )
+
+static unsigned int Processors = 1;			// processors on the user cluster, including the main processor
+
+// Each benchmark performs N operations and returns the elapsed wall-clock time per operation in nanoseconds.
+
+static double perOp( uTime start, unsigned int N ) {
+    return (double)( uClock::currTime() - start ).nanoseconds() / N;
+} // perOp
+
+
+//######################### context switch #########################
+
+
+_Coroutine Resumee {
+    void main() {
+	for ( ;; ) suspend();
+    } // Resumee::main
+  public:
+    void next() { resume(); }
+}; // Resumee
+
+double CoroutineResume( unsigned int N ) {
+    Resumee c;
+    uTime start = uClock::currTime();
+    for ( unsigned int i = 0; i < N; i += 1 ) c.next();
+    return perOp( start, N );
+} // CoroutineResume
+
+_Task Yielder {
+    unsigned int N;
+    void main() {
+	for ( unsigned int i = 0; i < N; i += 1 ) yield();
+    } // Yielder::main
+  public:
+    Yielder( uCluster &cluster, unsigned int N ) : uBaseTask( cluster ), N( N ) {}
+}; // Yielder
+
+double ContextSwitch( unsigned int N ) {		// two tasks alternate on a dedicated processor
+    uCluster cluster( "yield" );
+    uProcessor processor( cluster );
+    uTime start = uClock::currTime();
+    {
+	Yielder y1( cluster, N ), y2( cluster, N );
+    }
+    return perOp( start, 2 * N );
+} // ContextSwitch
+
+_Task Nop {
+    void main() {}
+}; // Nop
+
+double TaskCreateDelete( unsigned int N ) {
+    uTime start = uClock::currTime();
+    for ( unsigned int i = 0; i < N; i += 1 ) {
+	Nop t;
+    } // for
+    return perOp( start, N );
+} // TaskCreateDelete
+
+double TaskForkJoin( unsigned int N ) {		// heap-allocated batches, as pthread_create and COFOR
+    enum { Batch = 16 };
+    Nop *tasks[Batch];
+    unsigned int rounds = std::max( N / Batch, 1u );
+    uTime start = uClock::currTime();
+    for ( unsigned int i = 0; i < rounds; i += 1 ) {
+	for ( unsigned int j = 0; j < Batch; j += 1 ) tasks[j] = new Nop;
+	for ( unsigned int j = 0; j < Batch; j += 1 ) delete tasks[j];
+    } // for
+    return perOp( start, rounds * Batch );
+} // TaskForkJoin
+
+
+//######################### monitor #########################
+
+
+_Monitor Mon {
+    uCondition a, b;
+  public:
+    volatile bool here = false;
+
+    int call( int v ) { return v; }
+
+    void acceptor( unsigned int N ) {
+	here = true;
+	for ( unsigned int i = 0; i < N; i += 1 ) _Accept( call );
+    } // Mon::acceptor
+
+    void sigwait( unsigned int N, bool first ) {
+	uCondition &mine = first ? a : b, &other = first ? b : a;
+	for ( unsigned int i = 0; i < N; i += 1 ) {
+	    other.signal();
+	    mine.wait();
+	} // for
+	other.signal();
+    } // Mon::sigwait
+}; // Mon
+
+double MonitorCall( unsigned int N ) {
+    Mon m;
+    volatile int rv __attribute__(( unused ));
+    uTime start = uClock::currTime();
+    for ( unsigned int i = 0; i < N; i += 1 ) rv = m.call( i );
+    return perOp( start, N );
+} // MonitorCall
+
+_Task MonAcceptor {
+    Mon &m;
+    unsigned int N;
+    void main() { m.acceptor( N ); }
+  public:
+    MonAcceptor( Mon &m, unsigned int N ) : m( m ), N( N ) {}
+}; // MonAcceptor
+
+double MonitorAccept( unsigned int N ) {
+    Mon m;
+    MonAcceptor acceptor( m, N );
+    while ( ! m.here ) uThisTask().yield();
+    uTime start = uClock::currTime();
+    for ( unsigned int i = 0; i < N; i += 1 ) {
+	m.call( i );
+	uThisTask().yield();				// let acceptor accept next call
+    } // for
+    return perOp( start, N );
+} // MonitorAccept
+
+_Task MonSignaller {
+    Mon &m;
+    unsigned int N;
+    void main() { m.sigwait( N, false ); }
+  public:
+    MonSignaller( Mon &m, unsigned int N ) : m( m ), N( N ) {}
+}; // MonSignaller
+
+double MonitorSignal( unsigned int N ) {
+    Mon m;
+    uTime start = uClock::currTime();
+    {
+	MonSignaller partner( m, N );
+	m.sigwait( N, true );
+    }
+    return perOp( start, 2 * N );
+} // MonitorSignal
+
+
+//######################### locks #########################
+
+
+double SemaphoreUncontended( unsigned int N ) {
+    uSemaphore s( 1 );
+    uTime start = uClock::currTime();
+    for ( unsigned int i = 0; i < N; i += 1 ) {
+	s.P();
+	s.V();
+    } // for
+    return perOp( start, N );
+} // SemaphoreUncontended
+
+_Task SemPartner {
+    uSemaphore &mine, &other;
+    unsigned int N;
+    uDuration *timeout;
+    void main() {
+	for ( unsigned int i = 0; i < N; i += 1 ) {
+	    if ( timeout ) mine.P( *timeout ); else mine.P();
+	    other.V();
+	} // for
+    } // SemPartner::main
+  public:
+    SemPartner( uSemaphore &mine, uSemaphore &other, unsigned int N, uDuration *timeout = nullptr ) :
+	mine( mine ), other( other ), N( N ), timeout( timeout ) {}
+}; // SemPartner
+
+double SemaphorePingPong( unsigned int N ) {
+    uSemaphore s1( 0 ), s2( 0 );
+    uTime start = uClock::currTime();
+    {
+	SemPartner t1( s1, s2, N ), t2( s2, s1, N );
+	s1.V();						// start cycle
+    }
+    return perOp( start, 2 * N );
+} // SemaphorePingPong
+
+// Each blocking P inserts a timer event that is removed when the V arrives before the timeout.
+double TimerInsertRemove( unsigned int N ) {
+    uSemaphore s1( 0 ), s2( 0 );
+    uDuration timeout( 60 );
+    uTime start = uClock::currTime();
+    {
+	SemPartner t1( s1, s2, N, &timeout ), t2( s2, s1, N, &timeout );
+	s1.V();
+    }
+    return perOp( start, 2 * N );
+} // TimerInsertRemove
+
+template< typename Lock > _Task Locker {
+    Lock &lock;
+    unsigned int N;
+    void main() {
+	for ( unsigned int i = 0; i < N; i += 1 ) {
+	    lock.acquire();
+	    lock.release();
+	} // for
+    } // Locker::main
+  public:
+    Locker( Lock &lock, unsigned int N ) : lock( lock ), N( N ) {}
+}; // Locker
+
+template< typename Lock > double LockContended( unsigned int N ) { // one task per processor
+    Lock lock;
+    unsigned int tasks = std::max( Processors, 2u ), per = N / tasks;
+    uTime start = uClock::currTime();
+    {
+	Locker< Lock > *lockers[tasks];
+	for ( unsigned int i = 0; i < tasks; i += 1 ) lockers[i] = new Locker< Lock >( lock, per );
+	for ( unsigned int i = 0; i < tasks; i += 1 ) delete lockers[i];
+    }
+    return perOp( start, per * tasks );
+} // LockContended
+
+
+//######################### futures, executor, actors #########################
+
+
+double FutureExecutor( unsigned int N ) {
+    uExecutor executor( 1, 1, false, -1 );
+    uTime start = uClock::currTime();
+    for ( unsigned int i = 0; i < N; i += 1 ) {
+	Future_ISM<unsigned int> f = executor.sendrecv( [i]() { return i; } );
+	f();						// wait for result
+    } // for
+    return perOp( start, N );
+} // FutureExecutor
+
+double ExecutorSend( unsigned int N ) {
+    volatile unsigned int done = 0;
+    uTime start;
+    {
+	uExecutor executor( 1, 1, false, -1 );
+	start = uClock::currTime();
+	for ( unsigned int i = 0; i < N; i += 1 ) {
+	    executor.send( [&done]() { uFetchAdd( done, 1 ); } );
+	} // for
+    } // wait for executor to drain
+    assert( done == N );
+    return perOp( start, N );
+} // ExecutorSend
+
+struct BenchMsg : public uActor::Message {} benchMsg;
+
+_Actor Bouncer {
+    unsigned int cycle = 0, cycles;
+
+    Allocation receive( Message &msg ) {
+	Case( BenchMsg, msg ) {
+	    if ( cycles == 0 || ++cycle < cycles ) {	// initiator counts cycles
+		msg.sender->tell( benchMsg, this );
+		return Nodelete;
+	    } // if
+	    msg.sender->tell( stopMsg, this );
+	} // Case
+	return Finished;
+    } // Bouncer::receive
+  public:
+    Bouncer( unsigned int cycles = 0 ) : cycles( cycles ) {}
+}; // Bouncer
+
+double ActorPingPong( unsigned int N ) {
+    uTime start;
+    {
+	uActorStart();
+	Bouncer ping( N ), pong;
+	start = uClock::currTime();
+	ping.tell( benchMsg, &pong );
+	uActorStop();
+    }
+    return perOp( start, 2 * N );
+} // ActorPingPong
+
+
+//######################### I/O #########################
+
+
+enum { EchoSize = 64 };
+
+_Task EchoServer {
+    uSocketServer &server;
+    unsigned int N;
+    void main() {
+	uSocketAccept acceptor( server );
+	char buf[EchoSize];
+	for ( unsigned int i = 0; i < N; i += 1 ) {
+	    for ( int len = 0; len < EchoSize; ) len += acceptor.read( buf + len, EchoSize - len );
+	    acceptor.write( buf, EchoSize );
+	} // for
+    } // EchoServer::main
+  public:
+    EchoServer( uSocketServer &server, unsigned int N ) : server( server ), N( N ) {}
+}; // EchoServer
+
+double SocketEcho( unsigned int N ) {			// round trip through uNBIO over a UNIX-domain socket
+    char name[64];
+    snprintf( name, sizeof(name), "BenchSuite.%d", getpid() );
+    unlink( name );
+    double result;
+    {
+	uSocketServer server( name );
+	EchoServer echo( server, N );
+	uSocketClient client( name );
+	char buf[EchoSize] = { 0 };
+	uTime start = uClock::currTime();
+	for ( unsigned int i = 0; i < N; i += 1 ) {
+	    client.write( buf, EchoSize );
+	    for ( int len = 0; len < EchoSize; ) len += client.read( buf + len, EchoSize - len );
+	} // for
+	result = perOp( start, N );
+    }
+    unlink( name );
+    return result;
+} // SocketEcho
+
+
+//######################### memory allocation #########################
+
+
+_Task Allocator {
+    unsigned int N;
+    void main() {
+	for ( unsigned int i = 0; i < N; i += 1 ) {
+	    void *p = malloc( 64 + i % 256 );
+	    *(volatile char *)p = 0;
+	    free( p );
+	} // for
+    } // Allocator::main
+  public:
+    Allocator( unsigned int N ) : N( N ) {}
+}; // Allocator
+
+double MallocFree( unsigned int N ) {			// one allocating task per processor
+    unsigned int per = N / Processors;
+    uTime start = uClock::currTime();
+    {
+	Allocator *allocators[Processors];
+	for ( unsigned int i = 0; i < Processors; i += 1 ) allocators[i] = new Allocator( per );
+	for ( unsigned int i = 0; i < Processors; i += 1 ) delete allocators[i];
+    }
+    return perOp( start, per * Processors );
+} // MallocFree
+
+enum { Batch = 1024 };
+
+_Task Freer {
+    void **blocks;
+    uSemaphore &full, &empty;
+    unsigned int rounds;
+    void main() {
+	for ( unsigned int r = 0; r < rounds; r += 1 ) {
+	    full.P();
+	    for ( unsigned int i = 0; i < Batch; i += 1 ) free( blocks[i] );
+	    empty.V();
+	} // for
+    } // Freer::main
+  public:
+    Freer( void **blocks, uSemaphore &full, uSemaphore &empty, unsigned int rounds ) :
+	blocks( blocks ), full( full ), empty( empty ), rounds( rounds ) {}
+}; // Freer
+
+double MallocRemoteFree( unsigned int N ) {		// blocks allocated by one task and freed by another
+    void *blocks[Batch];
+    uSemaphore full( 0 ), empty( 0 );
+    unsigned int rounds = std::max( N / Batch, 1u );
+    uTime start = uClock::currTime();
+    {
+	Freer freer( blocks, full, empty, rounds );
+	for ( unsigned int r = 0; r < rounds; r += 1 ) {
+	    for ( unsigned int i = 0; i < Batch; i += 1 ) blocks[i] = malloc( 64 + i % 256 );
+	    full.V();
+	    empty.P();
+	} // for
+    }
+    return perOp( start, rounds * Batch );
+} // MallocRemoteFree
+
+
+//######################### priority heap #########################
+
+
+// Scheduler hot path: each operation removes the highest-priority level and reinserts it with a new priority, with
+// levels recording their heap position as the priority schedulers do.
+
+enum { Levels = 32 };
+struct Level { int index; };
+
+static int levelCompare( int k1, int k2 ) {		// smaller value => higher priority
+    return k1 < k2 ? 1 : k1 == k2 ? 0 : -1;
+} // levelCompare
+
+static void levelExchange( uHeapable<int, Level *> &x, uHeapable<int, Level *> &y ) {
+    std::swap( x, y );
+    std::swap( x.data->index, y.data->index );
+} // levelExchange
+
+struct LevelIndex {
+    static void moved( uHeapable<int, Level *> &elem, int index ) { elem.data->index = index; }
+}; // LevelIndex
+
+template< typename Heap > double HeapHold( Heap &heap, unsigned int N ) {
+    Level levels[Levels];
+    for ( int i = 0; i < Levels; i += 1 ) {
+	levels[i].index = heap.size() + 1;
+	heap.insert( i, &levels[i] );
+    } // for
+    unsigned int seed = 1;
+    uTime start = uClock::currTime();
+    for ( unsigned int i = 0; i < N; i += 1 ) {
+	uHeapable<int, Level *> root;
+	heap.getRoot( root );
+	heap.deleteRoot();
+	seed = seed * 1103515245 + 12345;		// deterministic priorities
+	heap.insert( ( seed >> 16 ) % 1024, root.data );
+    } // for
+    return perOp( start, N );
+} // HeapHold
+
+double BinaryHeap( unsigned int N ) {
+    uHeap<int, Level *, Levels> heap( levelCompare, levelExchange );
+    return HeapHold( heap, N );
+} // BinaryHeap
+
+double DynamicBinaryHeap( unsigned int N ) {
+    uDynamicHeap<int, Level *> heap( levelCompare, levelExchange );
+    return HeapHold( heap, N );
+} // DynamicBinaryHeap
+
+double DaryHeap( unsigned int N ) {
+    uStaticDaryHeap<int, Level *, Levels, uHeapMin<int>, LevelIndex> heap;
+    return HeapHold( heap, N );
+} // DaryHeap
+
+
+//######################### driver #########################
+
+
+struct Benchmark {
+    const char *name;
+    double (*run)( unsigned int N );
+    unsigned int divisor;				// reduce iterations for expensive operations
+} benchmarks[] = {
+    { "coroutine_resume", CoroutineResume, 1 },
+    { "context_switch", ContextSwitch, 1 },
+    { "task_create_delete", TaskCreateDelete, 10 },
+    { "task_fork_join", TaskForkJoin, 10 },
+    { "monitor_call", MonitorCall, 1 },
+    { "monitor_accept", MonitorAccept, 1 },
+    { "monitor_signal", MonitorSignal, 1 },
+    { "semaphore_uncontended", SemaphoreUncontended, 1 },
+    { "semaphore_pingpong", SemaphorePingPong, 1 },
+    { "owner_lock_contended", LockContended< uOwnerLock >, 1 },
+    { "adaptive_lock_contended", LockContended< uAdaptiveLock<> >, 1 },
+    { "adaptive_owner_lock_contended", LockContended< uAdaptiveOwnerLock >, 1 },
+    { "timer_insert_remove", TimerInsertRemove, 10 },
+    { "future_executor", FutureExecutor, 10 },
+    { "executor_send", ExecutorSend, 10 },
+    { "actor_pingpong", ActorPingPong, 1 },
+    { "socket_echo", SocketEcho, 10 },
+    { "malloc_free", MallocFree, 1 },
+    { "malloc_remote_free", MallocRemoteFree, 1 },
+    { "heap_binary", BinaryHeap, 1 },
+    { "heap_binary_dynamic", DynamicBinaryHeap, 1 },
+    { "heap_dary", DaryHeap, 1 },
+};
+
+struct Summary {
+    double min, p50, p90, p99, max, mean;
+}; // Summary
+
+static Summary summarize( double samples[], unsigned int R ) {
+    std::sort( samples, samples + R );
+    auto rank = [&]( double q ) { return samples[(unsigned int)( q * ( R - 1 ) + 0.5 )]; }; // nearest rank
+    double sum = 0;
+    for ( unsigned int i = 0; i < R; i += 1 ) sum += samples[i];
+    return Summary{ samples[0], rank( 0.5 ), rank( 0.9 ), rank( 0.99 ), samples[R - 1], sum / R };
+} // summarize
+
+int main( int argc, char *argv[] ) {
+    unsigned int R = 10, N = 100000;
+    const char *filter = nullptr;
+    bool json = false;
+
+    for ( int c; ( c = getopt( argc, argv, "p:r:n:f:j" ) ) != -1; ) {
+	switch ( c ) {
+	  case 'p': Processors = atoi( optarg ); break;
+	  case 'r': R = atoi( optarg ); break;
+	  case 'n': N = atoi( optarg ); break;
+	  case 'f': filter = optarg; break;
+	  case 'j': json = true; break;
+	  default:
+	    cerr << "Usage: " << argv[0] << " [ -p processors ] [ -r repetitions ] [ -n iterations ] [ -f name-filter ] [ -j ]" << endl;
+	    exit( EXIT_FAILURE );
+	} // switch
+    } // for
+    if ( Processors < 1 || R < 1 || N < 10 ) {
+	cerr << "Error: processors and repetitions must be > 0, and iterations >= 10." << endl;
+	exit( EXIT_FAILURE );
+    } // if
+
+    uProcessor *processors[Processors - 1];
+    for ( unsigned int i = 0; i < Processors - 1; i += 1 ) processors[i] = new uProcessor( uThisCluster() );
+
+#if defined( __U_MULTI__ )
+    const char *kind = "multi";
+#else
+    const char *kind = "uni";
+#endif // __U_MULTI__
+#if defined( __U_DEBUG__ )
+    const bool debug = true;
+#else
+    const bool debug = false;
+#endif // __U_DEBUG__
+
+    if ( json ) {
+	cout << "{\n  \"version\": \"" << VERSION << "\", \"kernel\": \"" << kind << "\", \"debug\": " << ( debug ? "true" : "false" )
+	     << ", \"processors\": " << Processors << ", \"repetitions\": " << R << ", \"iterations\": " << N << ",\n  \"benchmarks\": [";
+    } else {
+	cout << "uC++ " << VERSION << " " << kind << ( debug ? " debug" : "" ) << ", processors " << Processors
+	     << ", repetitions " << R << ", iterations " << N << ", ns/op" << endl;
+	cout << std::left << std::setw( 26 ) << "benchmark" << std::right;
+	for ( const char *col : { "min", "p50", "p90", "p99", "max", "mean" } ) cout << std::setw( 10 ) << col;
+	cout << endl;
+    } // if
+
+    const char *sep = "";
+    double samples[R];
+    for ( Benchmark &b : benchmarks ) {
+      if ( filter != nullptr && strstr( b.name, filter ) == nullptr ) continue;
+	unsigned int n = std::max( N / b.divisor, 10u );
+	b.run( n / 10 );				// warm up
+	for ( unsigned int r = 0; r < R; r += 1 ) samples[r] = b.run( n );
+	Summary s = summarize( samples, R );
+	cout << std::fixed << std::setprecision( 1 );
+	if ( json ) {
+	    cout << sep << "\n    { \"name\": \"" << b.name << "\", \"unit\": \"ns/op\", \"iterations\": " << n
+		 << ", \"min\": " << s.min << ", \"p50\": " << s.p50 << ", \"p90\": " << s.p90 << ", \"p99\": " << s.p99
+		 << ", \"max\": " << s.max << ", \"mean\": " << s.mean << " }";
+	    sep = ",";
+	} else {
+	    cout << std::left << std::setw( 26 ) << b.name << std::right << std::setw( 10 ) << s.min << std::setw( 10 ) << s.p50
+		 << std::setw( 10 ) << s.p90 << std::setw( 10 ) << s.p99 << std::setw( 10 ) << s.max << std::setw( 10 ) << s.mean << endl;
+	} // if
+    } // for
+    if ( json ) cout << "\n  ]\n}" << endl;
+
+    for ( unsigned int i = 0; i < Processors - 1; i += 1 ) delete processors[i];
+} // main
+
+// Local Variables: //
+// compile-command: "u++-work -g -O2 -multi -nodebug BenchSuite.cc" //
+// End: //
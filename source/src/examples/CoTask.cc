@@ -0,0 +1,119 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// CoTask.cc -- Many stackless coroutines pass messages through pipes, wait on a future delivered by a task, and share
+//     a coroutine semaphore, all multiplexed on a few carrier tasks.
+//
+// Author           :
+// Created On       : Sun Oct 18 15:58:12 2026
+// Last Modified By :
+// Last Modified On : Sun Oct 18 15:58:12 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+#include <uCoTask.h>
+#include <iostream>
+using std::cout;
+using std::endl;
+
+enum { Pipes = 128, Messages = 200, Tokens = 4 };
+
+uCoSemaphore tokens( Tokens );				// bound readers in the critical section
+unsigned int holders = 0, maxHolders = 0;
+unsigned long int total = 0;
+unsigned int finished = 0;
+
+uCoTask<> writer( uPipe &pipe, int id ) {
+    for ( int i = 0; i < Messages; i += 1 ) {
+	int msg = id * Messages + i;
+	ssize_t wlen = co_await uCoWrite( pipe.right(), &msg, sizeof(msg) );
+	assert( wlen == sizeof(msg) );
+	if ( i % 16 == 0 ) co_await uCoYield();
+    } // for
+} // writer
+
+uCoTask<int> receive( uPipe &pipe ) {			// one message, possibly in pieces
+    int msg;
+    size_t len = 0;
+    while ( len < sizeof(msg) ) {
+	ssize_t rlen = co_await uCoRead( pipe.left(), (char *)&msg + len, sizeof(msg) - len );
+	assert( rlen > 0 );
+	len += rlen;
+    } // while
+    co_return msg;
+} // receive
+
+uCoTask<> reader( uPipe &pipe, int id, Future_ISM<int> &start ) {
+    int scale = co_await uCoAwait( start );		// suspend until main's helper delivers
+    unsigned long int sum = 0;
+    for ( int i = 0; i < Messages; i += 1 ) {
+	int msg = co_await receive( pipe );
+	assert( msg == id * Messages + i );		// pipe preserves order
+	sum += msg;
+    } // for
+
+    co_await tokens.P();
+    unsigned int now = __atomic_add_fetch( &holders, 1, __ATOMIC_SEQ_CST );
+    if ( now > __atomic_load_n( &maxHolders, __ATOMIC_RELAXED ) ) __atomic_store_n( &maxHolders, now, __ATOMIC_RELAXED );
+    co_await uCoYield();				// hold the token across a reschedule
+    __atomic_fetch_add( &total, sum * scale, __ATOMIC_SEQ_CST );
+    __atomic_fetch_sub( &holders, 1, __ATOMIC_SEQ_CST );
+    tokens.V();
+    __atomic_fetch_add( &finished, 1, __ATOMIC_SEQ_CST );
+} // reader
+
+
+_Task Starter {						// ordinary task completes the future coroutines wait on
+    Future_ISM<int> &start;
+
+    void main() {
+	yield( 10 );
+	start.delivery( 2 );
+    } // Starter::main
+  public:
+    Starter( Future_ISM<int> &start ) : start( start ) {}
+}; // Starter
+
+
+int main() {
+    uProcessor processors[3] __attribute__(( unused )); // more than one processor => carriers run in parallel
+    uPipe *pipes = new uPipe[Pipes];
+    Future_ISM<int> start;
+    {
+	uCoScheduler scheduler( 4 );
+	for ( int i = 0; i < Pipes; i += 1 ) {
+	    scheduler.spawn( reader( pipes[i], i, start ) );
+	    scheduler.spawn( writer( pipes[i], i ) );
+	} // for
+	Starter starter( start );
+	scheduler.drain();
+    } // wait for carriers and poller
+    delete [] pipes;
+
+    unsigned long int expect = 0;
+    for ( unsigned long int m = 0; m < Pipes * Messages; m += 1 ) expect += m;
+    cout << "finished " << finished << " max tokens held " << maxHolders << endl;
+    assert( finished == Pipes );
+    assert( total == expect * 2 );
+    assert( maxHolders <= Tokens );
+    cout << "successful completion" << endl;
+} // main
+
+
+// Local Variables: //
+// compile-command: "u++ -std=c++20 CoTask.cc" //
+// End: //
@@ -0,0 +1,120 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// EarliestDeadlineFirst.cc -- Periodic tasks with a total utilization above the deadline-monotonic bound run under
+//     EDF with admission control, while an overrunning sporadic task is held to its bandwidth by its server.
+//
+// Author           :
+// Created On       : Sun Oct 18 12:52:03 2026
+// Last Modified By :
+// Last Modified On : Sun Oct 18 12:52:03 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+#include <uRealTime.h>
+#include <uEarliestDeadlineFirst.h>
+#include <iostream>
+using std::cout;
+using std::osacquire;
+using std::endl;
+
+const uDuration Millisecond( 0, 1000000 );
+uTime End;						// all tasks stop
+
+
+class AcrossCxtSw : public uContext {			// exclude time spent in other tasks from computation time
+    uTime &clock, beginCxtSw;
+  public:
+    AcrossCxtSw( uTime &clock ) : clock( clock ) {}
+    void save() { beginCxtSw = uClock::currTime(); }
+    void restore() { clock += uClock::currTime() - beginCxtSw; }
+}; // AcrossCxtSw
+
+void compute( uDuration C ) {
+    uTime delay = uClock::currTime() + C;
+    AcrossCxtSw acrossCxtSw( delay );
+    while ( delay > uClock::currTime() );
+} // compute
+
+
+_PeriodicTask Worker {
+    uDuration C;
+
+    void main() {
+	compute( C );
+    } // Worker::main
+  public:
+    Worker( uDuration C, uDuration period, uCluster &cluster ) :
+	uPeriodicBaseTask( period, uTime(), End, uDuration(), cluster ), C( C ) {}
+}; // Worker
+
+
+_SporadicTask Hog {					// never blocks => runs only on its server's bandwidth
+    void main() {
+	compute( 50 * Millisecond );
+    } // Hog::main
+  public:
+    Hog( uDuration frame, uDuration budget, uCluster &cluster ) :
+	    uSporadicBaseTask( frame, uTime(), End, uDuration(), cluster ) {
+	setBudget( budget );
+    } // Hog::Hog
+}; // Hog
+
+
+int main() {
+    uEarliestDeadlineFirst rq;
+    uRealTimeCluster cluster( rq );
+    struct { uDuration C, T; } load[] = {		// utilization 0.85 > 3 * (2^(1/3) - 1) = 0.78
+	{ 2 * Millisecond, 10 * Millisecond },
+	{ 6 * Millisecond, 20 * Millisecond },
+	{ 10 * Millisecond, 40 * Millisecond },
+    };
+    enum { N = sizeof(load) / sizeof(load[0]) };
+
+    cluster.setUtilizationBound( 0.95 );
+    for ( int i = 0; i < N; i += 1 ) {
+	bool admitted = cluster.admit( load[i].C, load[i].T );
+	assert( admitted );
+    } // for
+    assert( ! cluster.admit( 2 * Millisecond, 10 * Millisecond ) ); // 1.05 > bound
+    bool admitted = cluster.admit( Millisecond, 20 * Millisecond ); // server bandwidth 0.05
+    assert( admitted );
+    cout << "admitted utilization " << cluster.getUtilization() << endl;
+
+    ::End = uClock::currTime() + 2;
+    uProcessor *processor;
+    {
+	Worker *workers[N];
+	for ( int i = 0; i < N; i += 1 ) workers[i] = new Worker( load[i].C, load[i].T, cluster );
+	Hog hog( 20 * Millisecond, Millisecond, cluster );
+	processor = new uProcessor( cluster );
+	uBaseTask::sleep( ::End + uDuration( 0, 500000000 ) ); // tasks finish their last job
+	for ( int i = 0; i < N; i += 1 ) {
+	    osacquire( cout ) << "worker " << i << " jobs " << workers[i]->getJobs() << " misses " << workers[i]->getDeadlineMisses() << endl;
+	    delete workers[i];
+	} // for
+    } // wait for hog
+    delete processor;
+    cout << "jobs " << rq.getJobs() << " misses " << rq.getDeadlineMisses() << " server postponements " << rq.getPostponements() << endl;
+    assert( rq.getPostponements() > 0 );
+    cout << "successful completion" << endl;
+} // main
+
+
+// Local Variables: //
+// compile-command: "u++ EarliestDeadlineFirst.cc" //
+// End: //
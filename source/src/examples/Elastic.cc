@@ -0,0 +1,77 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// Elastic.cc -- A burst of compute tasks makes an elastic cluster add processors up to its maximum, and the processors
+//     are removed again once the cluster is idle.
+//
+// Author           :
+// Created On       : Sun Oct 18 18:31:09 2026
+// Last Modified By :
+// Last Modified On : Sun Oct 18 18:31:09 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+#include <uElastic.h>
+#include <iostream>
+using std::cout;
+using std::endl;
+
+enum { Min = 1, Max = 4, Workers = 16 };
+
+_Task Worker {						// compute bound, yields so others share the processors
+    void main() {
+	uTime end = uClock::currTime() + uDuration( 0, 400000000 );
+	while ( uClock::currTime() < end ) {
+	    for ( volatile int i = 0; i < 10000; i += 1 ) {}
+	    yield();
+	} // while
+    } // Worker::main
+  public:
+    Worker( uCluster &cluster ) : uBaseTask( cluster ) {}
+}; // Worker
+
+void print( const char *when, const uElasticProcessors::Statistics &stats ) {
+    cout << when << ": processors " << stats.processors << " peak " << stats.peak << " grows " << stats.grows
+	 << " shrinks " << stats.shrinks << " parks " << stats.parks << " wakes " << stats.wakes << endl;
+} // print
+
+int main() {
+    uCluster cluster( "elastic" );
+    uElasticProcessors elastic( cluster, Min, Max, uDuration( 0, 5000000 ) ); // 5 ms samples
+    elastic.setHysteresis( 2, 20 );
+    assert( cluster.getProcessors() == Min );
+
+    {
+	Worker *workers[Workers];
+	for ( int i = 0; i < Workers; i += 1 ) workers[i] = new Worker( cluster );
+	for ( int i = 0; i < Workers; i += 1 ) delete workers[i];
+    }
+    uElasticProcessors::Statistics stats = elastic.statistics();
+    print( "after burst", stats );
+    assert( stats.peak == Max && stats.grows >= Max - Min ); // never above the bound
+
+    uBaseTask::sleep( uDuration( 2 ) );		// idle cluster releases the added processors
+    stats = elastic.statistics();
+    print( "after idle", stats );
+    assert( stats.processors == Min && stats.shrinks == stats.grows && stats.added == 0 );
+    cout << "successful completion" << endl;
+} // main
+
+
+// Local Variables: //
+// compile-command: "u++ -multi Elastic.cc" //
+// End: //
@@ -0,0 +1,92 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// FairShare.cc -- Compute-bound tasks with different weights share one processor of a cluster using the fair-share
+//     ready queue in proportion to their weights, and a task that mostly sleeps is not starved.
+//
+// Author           :
+// Created On       : Sun Oct 18 19:40:03 2026
+// Last Modified By :
+// Last Modified On : Sun Oct 18 19:40:03 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+#include <uFairScheduler.h>
+#include <iostream>
+using std::cout;
+using std::endl;
+
+const uDuration Millisecond( 0, 1000000 );
+uTime End;						// all tasks stop
+
+_Task Hog {						// compute bound, yields often so shares are fine grained
+    void main() {
+	while ( uClock::currTime() < End ) {
+	    for ( volatile int i = 0; i < 20000; i += 1 ) {}
+	    yield();
+	} // while
+    } // Hog::main
+  public:
+    Hog( unsigned int weight, uCluster &cluster ) : uBaseTask( cluster ) {
+	setWeight( weight );
+    } // Hog::Hog
+}; // Hog
+
+_Task Sleeper {						// wakes every few milliseconds, measures delay to run
+    void main() {
+	while ( uClock::currTime() < End ) {
+	    uTime wake = uClock::currTime() + 5 * Millisecond;
+	    sleep( wake );
+	    uDuration late = uClock::currTime() - wake;
+	    if ( late > worst ) worst = late;
+	} // while
+    } // Sleeper::main
+  public:
+    uDuration worst;
+
+    Sleeper( uCluster &cluster ) : uBaseTask( cluster ), worst( 0 ) {}
+}; // Sleeper
+
+int main() {
+    uFairScheduler rq;
+    uCluster cluster( rq, "fair" );
+    uProcessor processor( cluster );
+
+    ::End = uClock::currTime() + 2;
+    uDuration lightTime, heavyTime, sleeperTime, worst;
+    {
+	Sleeper sleeper( cluster );
+	Hog light( uBaseTask::DefaultWeight, cluster ), heavy( 2 * uBaseTask::DefaultWeight, cluster );
+	uBaseTask::sleep( ::End );
+	lightTime = light.getExecutionTime();		// compare before either hog runs alone at the end
+	heavyTime = heavy.getExecutionTime();
+	sleeperTime = sleeper.getExecutionTime();
+	worst = sleeper.worst;
+    } // wait for tasks
+
+    double ratio = heavyTime.nanoseconds() / (double)lightTime.nanoseconds();
+    cout << "light " << lightTime << " heavy " << heavyTime << " ratio " << ratio
+	 << " sleeper " << sleeperTime << " worst wakeup delay " << worst << endl;
+    assert( 1.5 < ratio && ratio < 2.5 );		// processor divided 1:2
+    assert( worst < 50 * Millisecond );		// waking task runs ahead of the hogs
+    cout << "successful completion" << endl;
+} // main
+
+
+// Local Variables: //
+// compile-command: "u++ FairShare.cc" //
+// End: //
@@ -673,6 +673,29 @@ int main() {
 	    } // _Select
 	} // for
     }
+    {
+	enum { NoOfFutures = 1000 };
+	Future_ISM<int> f[NoOfFutures];
+	bool seen[NoOfFutures] = { false };
+	for ( unsigned int i = 0; i < NoOfFutures; i += 10 ) f[i].delivery( 3 ); // some available before add
+	uWaitQueue_ISM< Future_ISM<int> > q( f, f + NoOfFutures );
+	q.remove( f[NoOfFutures - 1] );			// never dropped
+	Worker *workers[NoOfFutures];
+	for ( unsigned int i = 0; i < NoOfFutures; i += 1 ) {
+	    workers[i] = i % 10 == 0 ? nullptr : new Worker( f[i] ); // deliver in random order
+	} // for
+
+	for ( unsigned int d = 0; d < NoOfFutures - 1; d += 1 ) {
+	    Future_ISM<int> r = q.drop();
+	    unsigned int i = 0;
+	    for ( ; ! r.equals( f[i] ); i += 1 );
+	    assert( r.available() && r() == 3 );
+	    assert( ! seen[i] );			// each future dropped exactly once
+	    seen[i] = true;
+	} // for
+	assert( q.empty() && ! seen[NoOfFutures - 1] );
+	for ( unsigned int i = 0; i < NoOfFutures; i += 1 ) delete workers[i];
+    }
 
     cout << "successful completion" << endl;
 } // main
@@ -0,0 +1,80 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// HeapTrim.cc -- Check freed bucket storage is returned to the operating system by malloc_trim and by the free
+//     threshold set with mallopt( M_TRIM_THRESHOLD ).
+//
+// Author           :
+// Created On       : Sun Oct 18 14:21:47 2026
+// Last Modified By :
+// Last Modified On : Sun Oct 18 14:21:47 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+#include <malloc.h>					// malloc_trim, mallopt
+#include <cstring>					// memset
+#include <cstdio>					// fopen
+#include <unistd.h>					// sysconf
+#include <iostream>
+using std::cout;
+using std::endl;
+
+enum { Blocks = 256, Size = 256 * 1024 };		// below mmap crossover => bucket storage
+
+size_t rss() {						// resident set size in bytes
+    size_t size = 0, pages = 0;
+    FILE *statm = fopen( "/proc/self/statm", "r" );
+    if ( statm != nullptr ) {
+	if ( fscanf( statm, "%zu %zu", &size, &pages ) != 2 ) pages = 0;
+	fclose( statm );
+    } // if
+    return pages * sysconf( _SC_PAGESIZE );
+} // rss
+
+size_t spike( char *blocks[] ) {			// touch then free Blocks * Size bytes, return peak rss
+    for ( int i = 0; i < Blocks; i += 1 ) {
+	blocks[i] = (char *)malloc( Size );
+	memset( blocks[i], i, Size );
+    } // for
+    size_t peak = rss();
+    for ( int i = 0; i < Blocks; i += 1 ) free( blocks[i] );
+    return peak;
+} // spike
+
+int main() {
+    char *blocks[Blocks];
+
+    size_t peak = spike( blocks );
+    size_t before = rss();
+    int released = malloc_trim( 0 );
+    size_t after = rss();
+    cout << "trim: peak " << peak << " before " << before << " after " << after << endl;
+    assert( released == 1 );
+    assert( after + Blocks * Size / 2 < before );	// most freed storage released
+
+    assert( mallopt( M_TRIM_THRESHOLD, 64 * 1024 ) == 0 ); // release large blocks on free
+    peak = spike( blocks );
+    after = rss();
+    cout << "threshold: peak " << peak << " after " << after << endl;
+    malloc_stats();
+    cout << "successful completion" << endl;
+} // main
+
+
+// Local Variables: //
+// compile-command: "u++ HeapTrim.cc" //
+// End: //
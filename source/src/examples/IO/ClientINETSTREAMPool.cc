@@ -0,0 +1,165 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// ClientINETSTREAMPool.cc -- Fan-out requests from a client pool to an echo server in the same program. Connections
+//     are started together, reused after checkin, discarded when the server closes them, and a failed connect raises
+//     OpenFailure.
+//
+// Author           :
+// Created On       : Sun Oct 18 23:41:09 2026
+// Last Modified By :
+// Last Modified On : Sun Oct 18 23:41:09 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+//
+
+#include <uSocket.h>
+#include <iostream>
+#include <cstdio>
+#include <algorithm>
+using std::cout;
+using std::endl;
+
+enum { Acceptors = 16, Fanout = 4, Rounds = 50, BufferSize = 16 };
+const char Quit = 'q';									// request server to close connection
+volatile bool done = false;
+volatile unsigned int closed = 0;						// connections closed by server
+
+_Task Acceptor {										// echo requests until client closes or quits
+	uSocketServer &server;
+
+	void main() {
+		uDuration timeout( 1 );							// check for completion
+		char buf[BufferSize];
+
+		while ( ! done ) {
+			try {
+				uSocketAccept acceptor( server, &timeout );
+				for ( ;; ) {
+					int len = acceptor.read( buf, sizeof(buf) );
+				  if ( len == 0 || buf[0] == Quit ) break;
+					acceptor.write( buf, len );
+				} // for
+			} catch( uSocketAccept::OpenTimeout & ) {
+				continue;
+			} catch( uSocketAccept::ReadFailure & ) {	// client reset connection
+			} // try
+			uFetchAdd( closed, 1 );
+		} // while
+	} // Acceptor::main
+  public:
+	Acceptor( uSocketServer &server ) : server( server ) {
+	} // Acceptor::Acceptor
+}; // Acceptor
+
+void rpc( uSocketClient &client, int value ) {
+	char request[BufferSize], reply[BufferSize];
+	int len = snprintf( request, sizeof(request), "%d", value ), rlen = 0;
+
+	client.write( request, len );
+	while ( rlen < len ) {								// reply may arrive in pieces
+		int n = client.read( reply + rlen, sizeof(reply) - rlen );
+	  if ( n == 0 ) abort( "client %d : EOF ecountered before reply", getpid() );
+		rlen += n;
+	} // while
+	if ( rlen != len || memcmp( request, reply, len ) != 0 ) abort( "client %d : reply does not match request", getpid() );
+} // rpc
+
+_Task Caller {											// one branch of a fan-out request
+	uSocketClient &client;
+	int value;
+
+	void main() {
+		rpc( client, value );
+	} // Caller::main
+  public:
+	Caller( uSocketClient &client, int value ) : client( client ), value( value ) {
+	} // Caller::Caller
+}; // Caller
+
+int main() {
+	unsigned short port;
+	uSocketServer server( &port );						// create and bind a server socket to free port
+	in_addr local = uSocket::itoip( htonl( INADDR_LOOPBACK ) );
+	uDuration timeout( 5 );
+	Acceptor *acceptors[Acceptors];
+	for ( int i = 0; i < Acceptors; i += 1 ) acceptors[i] = new Acceptor( server );
+
+	{
+		uSocketClientPool pool;
+		uSocketClient *clients[Fanout], *first[Fanout];
+
+		pool.checkout( port, local, first, Fanout, &timeout ); // new connections started together
+		for ( int i = 0; i < Fanout; i += 1 ) pool.checkin( first[i] );
+		for ( int r = 0; r < Rounds; r += 1 ) {
+			pool.checkout( port, local, clients, Fanout, &timeout );
+			for ( int i = 0; i < Fanout; i += 1 ) {		// connections reused, none created
+				assert( std::find( first, first + Fanout, clients[i] ) != first + Fanout );
+			} // for
+			Caller *callers[Fanout];
+			for ( int i = 0; i < Fanout; i += 1 ) callers[i] = new Caller( *clients[i], r * Fanout + i );
+			for ( int i = 0; i < Fanout; i += 1 ) delete callers[i];
+			for ( int i = 0; i < Fanout; i += 1 ) pool.checkin( clients[i] );
+			assert( pool.idle( port, local ) == Fanout );
+		} // for
+
+		uSocketClient *dead = pool.checkout( port, local, &timeout );
+		dead->write( &Quit, sizeof(Quit) );				// server closes connection
+		while ( closed == 0 ) uBaseTask::yield();
+		pool.checkin( dead );							// pool does not know connection is closed
+		assert( pool.idle( port, local ) == Fanout );
+		{
+			uSocketClientPool::Lease lease( pool, port, local, &timeout );
+			assert( &lease.client() != dead && pool.idle( port, local ) == Fanout - 2 ); // dead client discarded
+			rpc( lease.client(), 42 );
+		} // lease returns client
+		assert( pool.idle( port, local ) == Fanout - 1 );
+
+		try {
+			uSocketClientPool::Lease lease( pool, port, local, &timeout );
+			rpc( lease.client(), 7 );
+			throw 1;									// exception => client deleted not returned
+		} catch( int ) {
+		} // try
+		assert( pool.idle( port, local ) == Fanout - 2 );
+
+		unsigned short unused;
+		{
+			uSocketServer probe( &unused );				// find a free port with no listener
+		}
+		try {
+			pool.checkout( unused, local, clients, Fanout, &timeout );
+			abort( "client %d : connect to closed port succeeded", getpid() );
+		} catch( uSocketClient::OpenFailure & ) {
+		} // try
+		assert( pool.idle( unused, local ) == 0 && pool.idle( port, local ) == Fanout - 2 );
+
+		uSocketClientPool small( 2 );					// at most 2 idle clients per endpoint
+		small.checkout( port, local, clients, Fanout, &timeout );
+		for ( int i = 0; i < Fanout; i += 1 ) small.checkin( clients[i] );
+		assert( small.idle( port, local ) == 2 );
+	} // delete pools => close idle connections
+
+	done = true;
+	for ( int i = 0; i < Acceptors; i += 1 ) delete acceptors[i];
+	cout << "successful completion" << endl;
+} // main
+
+// Local Variables: //
+// tab-width: 4 //
+// compile-command: "u++-work ClientINETSTREAMPool.cc" //
+// End: //
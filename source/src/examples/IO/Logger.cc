@@ -0,0 +1,78 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// Logger.cc -- Many tasks log concurrently through an asynchronous logger. The log file is read back to check no record
+//     is lost or torn with the blocking policy, and that records from each task appear in order.
+//
+// Author           :
+// Created On       : Sun Oct 18 10:05:12 2026
+// Last Modified By :
+// Last Modified On : Sun Oct 18 10:05:12 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+#include <uLog.h>
+#include <fstream>
+#include <iostream>
+using std::cout;
+using std::endl;
+#include <unistd.h>					// unlink
+
+enum { Tasks = 200, Records = 1000 };
+const char *logFile = "xxx";
+
+_Task Worker {
+    uLogger &log;
+    int id;
+
+    void main() {
+	for ( int i = 0; i < Records; i += 1 ) {
+	    uLogRecord( log ) << id << ' ' << i << " the quick brown fox jumps over the lazy dog" << endl;
+	    if ( i % 64 == 0 ) yield();
+	} // for
+    } // Worker::main
+  public:
+    Worker( uLogger &log, int id ) : log( log ), id( id ) {}
+}; // Worker
+
+int main() {
+    uProcessor p[3] __attribute__(( unused ));		// extra processors => multiple shards in use
+    unlink( logFile );
+    {
+	uLogger log( logFile, uLogger::Block, 4, 16, 4096 ); // small pool forces backpressure
+	{
+	    Worker *workers[Tasks];
+	    for ( int i = 0; i < Tasks; i += 1 ) workers[i] = new Worker( log, i );
+	    for ( int i = 0; i < Tasks; i += 1 ) delete workers[i];
+	}
+	log.flush();
+	cout << "records " << log.records() << " dropped " << log.dropped() << endl;
+	assert( log.records() == Tasks * Records && log.dropped() == 0 );
+    }
+
+    int next[Tasks] = { 0 }, id, seq, lines = 0;
+    std::string rest;
+    std::ifstream in( logFile );
+    while ( in >> id >> seq && getline( in, rest ) ) {
+	assert( 0 <= id && id < Tasks && seq == next[id] );
+	next[id] += 1;
+	lines += 1;
+    } // while
+    assert( lines == Tasks * Records );
+    cout << "lines " << lines << " in order" << endl;
+    unlink( logFile );
+} // main
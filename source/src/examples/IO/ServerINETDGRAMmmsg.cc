@@ -0,0 +1,90 @@
+//                              -*- Mode: C++ -*- 
+// 
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+// 
+// ServerINETDGRAMmmsg.cc -- Server for INET/datagram socket test using batched I/O. Server reads a batch of datagrams
+//     from multiple clients with one recvmmsg, and writes each datagram back to its sender with one sendmmsg.
+// 
+// Author           : 
+// Created On       : Sun Oct 18 09:12:31 2026
+// Last Modified By : 
+// Last Modified On : Sun Oct 18 09:12:31 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+// 
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+// 
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+// 
+
+#include <uSocket.h>
+#include <iostream>
+using std::cout;
+using std::cerr;
+using std::osacquire;
+using std::endl;
+
+enum { BufferSize = 8 * 1024, BatchSize = 16 };
+
+_Task Reader {
+	uSocketServer &server;
+
+	void main() {
+		uDuration timeout( 20, 0 );						// timeout for read
+		char bufs[BatchSize][BufferSize];
+		sockaddr_in from[BatchSize];
+		iovec iov[BatchSize];
+		mmsghdr msgs[BatchSize];
+
+		try {
+			for ( ;; ) {
+				for ( int i = 0; i < BatchSize; i += 1 ) {	// reset headers, recvmmsg overwrites lengths
+					iov[i] = { bufs[i], sizeof(bufs[i]) };
+					msgs[i].msg_hdr = { &from[i], sizeof(from[i]), &iov[i], 1, nullptr, 0, 0 };
+				} // for
+				int cnt = server.recvmmsg( msgs, BatchSize, 0, &timeout );
+				// osacquire( cerr ) << "reader read batch:" << cnt << endl;
+				for ( int i = 0; i < cnt; i += 1 ) {		// echo each datagram to its sender
+				  if ( msgs[i].msg_len == 0 ) abort( "server %d : EOF ecountered before timeout", getpid() );
+					iov[i].iov_len = msgs[i].msg_len;
+				} // for
+				server.sendmmsg( msgs, cnt );			// write batch back to clients
+			} // for
+		} catch( uSocketServer::ReadTimeout & ) {
+		} // try
+	} // Reader::main
+  public:
+	Reader( uSocketServer &server ) : server( server ) {
+	} // Reader::Reader
+}; // Reader
+
+int main( int argc, char *argv[] ) {
+	switch ( argc ) {
+	  case 1:
+		break;
+	  default:
+		cerr << "Usage: " << argv[0] << endl;
+		exit( EXIT_FAILURE );
+	} // switch
+
+	short unsigned int port;
+	uSocketServer server( &port, SOCK_DGRAM );			// create and bind a server socket to free port
+
+	cout << port << endl;								// print out free port for clients
+	{
+		Reader rd( server );							// execute until reader times out
+	}
+} // uMain
+
+// Local Variables: //
+// tab-width: 4 //
+// compile-command: "u++-work -o Server ServerINETDGRAMmmsg.cc" //
+// End: //
@@ -0,0 +1,135 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// SpliceZeroCopy.cc -- Move a file to a socket with splice through a pipe, duplicate pipe data with tee, and send
+//     with MSG_ZEROCOPY, checking the data received and that every zero-copy send completes, both with and without
+//     SO_ZEROCOPY enabled.
+//
+// Author           :
+// Created On       : Mon Oct 19 10:41:06 2026
+// Last Modified By :
+// Last Modified On : Mon Oct 19 10:41:06 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+#include <uFile.h>
+#include <uSocket.h>
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <algorithm>									// min
+#include <fcntl.h>										// O_RDONLY
+using std::cout;
+using std::endl;
+using std::string;
+
+enum { Sends = 16, SendSize = 64 * 1024 };
+
+_Task Sink {												// read one connection until EOF
+	uSocketServer &server;
+	string &received;
+
+	void main() {
+		uSocketAccept acceptor( server );
+		char buf[4096];
+		for ( ;; ) {
+			int len = acceptor.read( buf, sizeof(buf) );
+		  if ( len == 0 ) break;
+			received.append( buf, len );
+		} // for
+	} // Sink::main
+  public:
+	Sink( uSocketServer &server, string &received ) : server( server ), received( received ) {
+	} // Sink::Sink
+}; // Sink
+
+string contents( const char *name ) {
+	uFile::FileAccess input( name, O_RDONLY );
+	string data;
+	char buf[4096];
+	for ( ;; ) {
+		int len = input.read( buf, sizeof(buf) );
+	  if ( len == 0 ) break;
+		data.append( buf, len );
+	} // for
+	return data;
+} // contents
+
+void zeroCopy( uSocketServer &server, unsigned short port, in_addr ip, bool enable ) {
+	char *data = new char[Sends * SendSize];			// must not change until sends complete
+	for ( int i = 0; i < Sends * SendSize; i += 1 ) data[i] = 'a' + i % 26;
+	string received;
+	{
+		Sink sink( server, received );
+		uSocketClient client( port, ip );
+		bool zerocopy = enable && client.setZeroCopy( true ) == 0; // kernel may not support SO_ZEROCOPY
+		uDuration timeout( 10 );
+		uint32_t first = 0, last = 0;
+		for ( int sent = 0, sends = 0; sent < Sends * SendSize; sends += 1 ) { // stream send may be partial
+			uint32_t id;
+			sent += client.sendZeroCopy( data + sent, Sends * SendSize - sent, id );
+			if ( sends == 0 ) first = id;
+			else if ( zerocopy ) assert( id == last + 1 );	// kernel ids are consecutive
+			last = id;
+			if ( ! zerocopy ) assert( client.zeroCopyCompleted( id ) ); // copied send is already complete
+		} // for
+		client.zeroCopyWait( last, &timeout );
+		for ( uint32_t id = first; id != last + 1; id += 1 ) assert( client.zeroCopyCompleted( id ) );
+		cout << "zero copy " << ( zerocopy ? "enabled" : "disabled" ) << " sends " << last - first + 1 << endl;
+	} // close connection, wait for sink
+	assert( received.size() == Sends * SendSize && memcmp( received.data(), data, received.size() ) == 0 );
+	delete [] data;
+} // zeroCopy
+
+int main( int argc, char *argv[] ) {
+	if ( argc != 2 ) abort( "Usage: %s file", argv[0] );
+	string expect = contents( argv[1] );
+	unsigned short port;
+	uSocketServer server( &port );						// create and bind a server socket to free port
+	in_addr local = uSocket::itoip( htonl( INADDR_LOOPBACK ) );
+
+	string received;
+	{													// file => pipe => socket
+		Sink sink( server, received );
+		uSocketClient client( port, local );
+		uFile::FileAccess input( argv[1], O_RDONLY );
+		uPipe pipe;
+		assert( client.splice( input, pipe, expect.size() ) == (ssize_t)expect.size() );
+	} // close connection, wait for sink
+	assert( received == expect );
+
+	{													// file => pipe at offset, duplicated by tee
+		uFile::FileAccess input( argv[1], O_RDONLY );
+		uPipe source, copy;
+		loff_t off = expect.size() / 2;
+		size_t len = std::min( expect.size() - off, (size_t)4096 ); // fits in a pipe
+		assert( source.right().splice( input, &off, nullptr, len ) == (ssize_t)len && off == (loff_t)( expect.size() / 2 + len ) );
+		assert( copy.right().tee( source.left(), len ) == (ssize_t)len ); // source data not consumed
+		char buf1[4096], buf2[4096];
+		assert( source.left().read( buf1, len ) == (int)len && copy.left().read( buf2, len ) == (int)len );
+		assert( memcmp( buf1, expect.data() + expect.size() / 2, len ) == 0 && memcmp( buf1, buf2, len ) == 0 );
+	}
+
+	zeroCopy( server, port, local, true );
+	zeroCopy( server, port, local, false );
+	cout << "successful completion" << endl;
+} // main
+
+// Local Variables: //
+// tab-width: 4 //
+// compile-command: "u++-work SpliceZeroCopy.cc" //
+// End: //
@@ -34,6 +34,7 @@ const unsigned int NoOfTimes = 50000;
 
 uOwnerLock sharedLock1;
 uAdaptiveLock<> sharedLock2;
+uAdaptiveOwnerLock sharedLock3;
 volatile uBaseTask *checkID;
 uSemaphore start(0);
 
@@ -121,6 +122,40 @@ _Task testerAL_TAR {
     }
 };
 
+_Task testerAOL_AR {
+    void main() {
+	for ( unsigned int i = 0; i < NoOfTimes; i += 1 ) {
+	    sharedLock3.acquire();
+	    checkID = &uThisTask();
+	    if ( i % 8 == 0 ) yield();			// mix long and short critical sections
+	    if ( checkID != &uThisTask() ) abort( "interference" );
+	    sharedLock3.acquire();
+	    if ( checkID != &uThisTask() ) abort( "interference" );
+	    sharedLock3.release();
+	    if ( checkID != &uThisTask() ) abort( "interference" );
+	    sharedLock3.release();
+	} // for
+    }
+};
+
+_Task testerAOL_TAR {
+    void main() {
+	for ( unsigned int i = 0; i < 100; i += 1 ) {
+	    while ( ! sharedLock3.tryacquire() ) yield();
+	    checkID = &uThisTask();
+	    yield();
+	    if ( checkID != &uThisTask() ) abort( "interference" );
+	    if ( ! sharedLock3.tryacquire() ) abort( "interference" );
+	    if ( checkID != &uThisTask() ) abort( "interference" );
+	    sharedLock3.release();
+	    yield();
+	    if ( checkID != &uThisTask() ) abort( "interference" );
+	    sharedLock3.release();
+	    yield(2);
+	} // for
+    }
+};
+
 class monitor {
     uOwnerLock lock;
     uCondLock cond1, cond2;
@@ -303,6 +338,16 @@ int main() {
 	} // for
     }
     cout << "completion uAdaptiveLock test" << endl;
+#endif
+#if 1
+    {							// test uAdaptiveOwnerLock
+	testerAOL_AR t1[2] __attribute__(( unused ));
+	testerAOL_TAR t2[2] __attribute__(( unused ));
+    }
+    uAdaptiveOwnerLock::Statistics stats = sharedLock3.statistics();
+    if ( stats.acquisitions != 2 * NoOfTimes + 2 * 100 ) abort( "lost acquisitions" );
+    if ( stats.blocks > stats.contentions || stats.budget < uAdaptiveOwnerLock::MinSpins || stats.budget > uAdaptiveOwnerLock::MaxSpins ) abort( "inconsistent statistics" );
+    cout << "completion uAdaptiveOwnerLock test, contentions " << stats.contentions << " blocks " << stats.blocks << endl;
 #endif
     {							// test uCondLock
 	monitor m;
@@ -0,0 +1,85 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// MappedFile.cc -- Read a file through a memory-mapped ifstream and check it parses, seeks and putbacks the same as
+//     the buffered ifstream, and that non-regular files fall back to buffered reads.
+//
+// Author           :
+// Created On       : Sun Oct 18 22:52:37 2026
+// Last Modified By :
+// Last Modified On : Sun Oct 18 22:52:37 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unistd.h>					// unlink
+using namespace std;
+
+enum { Lines = 200000 };
+const char *name = "MappedFile.data";
+
+struct Totals {
+    long int sum, lines, tail;
+    string last;
+}; // Totals
+
+Totals parse( ios_base::openmode mode, bool expectMapped ) {
+    Totals t = { 0, 0, 0, "" };
+    ifstream in( name, mode );
+    assert( in.is_open() && in.rdbuf()->is_mapped() == expectMapped );
+    long int n;
+    string word;
+    while ( in >> n >> word ) {
+	t.sum += n;
+	t.lines += 1;
+	t.last = word;
+    } // while
+    in.clear();
+    in.seekg( -12, ios_base::end );			// relative to end
+    in >> word >> t.tail;
+    in.seekg( 0 );
+    char c = in.get();
+    in.putback( c );					// putback inside get area
+    in >> n;
+    assert( c == '0' && n == 0 );
+    return t;
+} // parse
+
+int main() {
+    {
+	ofstream out( name );
+	for ( int i = 0; i < Lines; i += 1 ) out << i << " line" << i % 10 << "\n";
+	out << "end-marker 123456789\n";
+    }
+    Totals buffered = parse( ios_base::in, false );
+    Totals mapped = parse( ios_base::in | filebuf::mapped, true );
+    cout << "buffered " << buffered.lines << " " << buffered.sum << " mapped " << mapped.lines << " " << mapped.sum << endl;
+    assert( buffered.sum == mapped.sum && buffered.lines == mapped.lines && buffered.last == mapped.last );
+    assert( mapped.lines == Lines && mapped.tail == 123456789 );
+
+    ifstream empty( "/dev/null", ios_base::in | filebuf::mapped ); // not a regular file => buffered
+    assert( empty.is_open() && ! empty.rdbuf()->is_mapped() && empty.get() == EOF );
+    unlink( name );
+    cout << "successful completion" << endl;
+} // main
+
+
+// Local Variables: //
+// compile-command: "u++ MappedFile.cc" //
+// End: //
@@ -0,0 +1,71 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// NUMA.cc -- Create a cluster per memory node and check tasks on each cluster execute on CPUs of that node.
+//
+// Author           :
+// Created On       : Sun Oct 18 11:31:08 2026
+// Last Modified By :
+// Last Modified On : Sun Oct 18 11:31:08 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+#include <iostream>
+using std::cout;
+using std::osacquire;
+using std::endl;
+#include <cstring>					// memset
+
+_Task Worker {
+    void main() {
+	int node = uThisCluster().getNUMANode();
+	for ( int i = 0; i < 100; i += 1 ) {
+	    char *block = new char[1024 * 1024];	// large => mmapped on cluster's node
+	    memset( block, i, 1024 * 1024 );
+	    delete [] block;
+#if defined( __U_MULTI__ ) && defined( __U_AFFINITY__ )
+	    assert( uNUMA::currentNode() == node );
+#endif // __U_MULTI__ && __U_AFFINITY__
+	    yield();
+	} // for
+	osacquire( cout ) << "worker on node " << node << " done" << endl;
+    } // Worker::main
+  public:
+    Worker( uCluster &cluster ) : uBaseTask( cluster ) {}
+}; // Worker
+
+int main() {
+    unsigned int nodes = uNUMA::nodes();
+    cout << "nodes " << nodes << " main on node " << uNUMA::currentNode() << endl;
+
+    uCluster *clusters[nodes];
+    uProcessor *processors[nodes];
+    for ( unsigned int n = 0; n < nodes; n += 1 ) {
+	clusters[n] = new uCluster( "node" );
+	clusters[n]->setNUMANode( n );
+	processors[n] = new uProcessor( *clusters[n] );
+    } // for
+    {
+	Worker *workers[nodes * 2];
+	for ( unsigned int i = 0; i < nodes * 2; i += 1 ) workers[i] = new Worker( *clusters[i % nodes] );
+	for ( unsigned int i = 0; i < nodes * 2; i += 1 ) delete workers[i];
+    }
+    for ( unsigned int n = 0; n < nodes; n += 1 ) {
+	delete processors[n];
+	delete clusters[n];
+    } // for
+} // main
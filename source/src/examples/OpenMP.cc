@@ -0,0 +1,179 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// OpenMP.cc -- OpenMP parallel regions, worksharing loops, sections, single, critical and taskloop run as uC++ tasks
+//     on the processors of the user cluster, and mix with ordinary uC++ tasks. With argument "detach", a detached task
+//     must be rejected.
+//
+// Author           :
+// Created On       : Sun Oct 18 20:58:12 2026
+// Last Modified By :
+// Last Modified On : Sun Oct 18 20:58:12 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+#include <omp.h>
+#include <iostream>
+#include <cstring>
+using std::cout;
+using std::endl;
+
+enum { N = 100000, Teams = 4 };
+long sums[N];
+
+long loops( int team ) {				// every schedule covers each iteration exactly once
+    long total = 0, *hits = new long[N]();		// task stacks are small
+    #pragma omp parallel num_threads( team ) reduction( + : total )
+    {
+	#pragma omp for schedule( static )
+	for ( int i = 0; i < N; i += 1 ) hits[i] += 1;
+	#pragma omp for schedule( static, 7 ) nowait
+	for ( int i = 0; i < N; i += 1 ) total += i;
+	#pragma omp for schedule( dynamic, 13 )
+	for ( int i = N - 1; i >= 0; i -= 1 ) hits[i] += 1;
+	#pragma omp for schedule( guided )
+	for ( int i = 0; i < N; i += 3 ) hits[i] += 1;
+	#pragma omp for schedule( runtime )
+	for ( int i = 0; i < N; i += 1 ) hits[i] += 1;
+    }
+    for ( int i = 0; i < N; i += 1 ) assert( hits[i] == ( i % 3 == 0 ? 4 : 3 ) );
+    delete [] hits;
+    return total;
+} // loops
+
+_Task Client {						// uC++ task using OpenMP inside its main
+    long &result;
+
+    void main() {
+	result = loops( Teams );
+    } // Client::main
+  public:
+    Client( long &result ) : result( result ) {}
+}; // Client
+
+void ullLoops( int team, unsigned long long n ) {	// unsigned long long loops near maximum value, both directions
+    unsigned long long up = 0, down = 0, expectUp = 0, expectDown = 0;
+    #pragma omp parallel num_threads( team )
+    {
+	#pragma omp for schedule( dynamic, 5 ) reduction( + : up )
+	for ( unsigned long long i = ~0ull - n; i < ~0ull - 3; i += 3 ) up += ~0ull - i;
+	#pragma omp for schedule( guided ) reduction( + : down )
+	for ( unsigned long long i = ~0ull - 1; i > ~0ull - n; i -= 7 ) down += ~0ull - i;
+    }
+    for ( unsigned long long i = ~0ull - n; i < ~0ull - 3; i += 3 ) expectUp += ~0ull - i;
+    for ( unsigned long long i = ~0ull - 1; i > ~0ull - n; i -= 7 ) expectDown += ~0ull - i;
+    assert( up == expectUp && down == expectDown );
+} // ullLoops
+
+long taskloops( int team ) {				// taskloop covers each iteration once with firstprivate data
+    long *hits = new long[N](), scale = 2;
+    #pragma omp parallel num_threads( team )
+    #pragma omp single
+    {
+	#pragma omp taskloop firstprivate( scale ) grainsize( 100 )
+	for ( long i = N - 1; i >= 0; i -= 1 ) hits[i] += scale;
+	#pragma omp taskloop num_tasks( 4 )
+	for ( unsigned long long i = 0; i < N; i += 2 ) hits[i] += 1;
+    }
+    long total = 0;
+    for ( int i = 0; i < N; i += 1 ) {
+	assert( hits[i] == ( i % 2 == 0 ? 3 : 2 ) );
+	total += hits[i];
+    } // for
+    delete [] hits;
+    return total;
+} // taskloops
+
+int main( int argc, char *argv[] ) {
+    if ( argc > 1 && strcmp( argv[1], "detach" ) == 0 ) {
+	omp_event_handle_t event;
+	#pragma omp task detach( event )		// runtime must abort
+	{}
+	cout << "detached task not rejected" << endl;
+	return 1;
+    } // if
+
+    const long expect = (long)N * (N - 1) / 2;
+    assert( ! omp_in_parallel() && omp_get_num_threads() == 1 );
+
+    int members = 0, singles = 0, critical = 0;
+    int sections[3] = {};
+    #pragma omp parallel num_threads( Teams )
+    {
+	assert( omp_in_parallel() && omp_get_num_threads() == Teams );
+	#pragma omp atomic
+	members += 1;
+	#pragma omp single
+	singles += 1;
+	#pragma omp sections
+	{
+	    #pragma omp section
+	    sections[0] += 1;
+	    #pragma omp section
+	    sections[1] += 1;
+	    #pragma omp section
+	    sections[2] += 1;
+	}
+	for ( int i = 0; i < 1000; i += 1 ) {
+	    #pragma omp critical( counter )
+	    critical += 1;
+	}
+	int copy;
+	#pragma omp single copyprivate( copy )
+	copy = 42;
+	assert( copy == 42 );
+	#pragma omp barrier
+	#pragma omp master
+	assert( members == Teams );
+    }
+    assert( members == Teams && singles == 1 && critical == 1000 * Teams );
+    assert( sections[0] == 1 && sections[1] == 1 && sections[2] == 1 );
+
+    #pragma omp parallel for num_threads( Teams )	// combined construct
+    for ( int i = 0; i < N; i += 1 ) sums[i] = i;
+    for ( int i = 0; i < N; i += 1 ) assert( sums[i] == i );
+
+    assert( loops( Teams ) == expect );
+    assert( loops( 1 ) == expect );
+    ullLoops( Teams, N );
+    ullLoops( 1, N );
+    assert( taskloops( Teams ) == (long)N * 5 / 2 );
+
+    long results[3];
+    {							// concurrent regions from several uC++ tasks
+	Client c0( results[0] ), c1( results[1] ), c2( results[2] );
+    } // wait for clients
+    for ( int i = 0; i < 3; i += 1 ) assert( results[i] == expect );
+
+    omp_lock_t lock;
+    omp_init_lock( &lock );
+    int locked = 0;
+    #pragma omp parallel num_threads( Teams )
+    for ( int i = 0; i < 1000; i += 1 ) {
+	omp_set_lock( &lock );
+	locked += 1;
+	omp_unset_lock( &lock );
+    }
+    omp_destroy_lock( &lock );
+    assert( locked == 1000 * Teams );
+    cout << "successful completion" << endl;
+} // main
+
+
+// Local Variables: //
+// compile-command: "u++ -openmp -fopenmp OpenMP.cc" //
+// End: //
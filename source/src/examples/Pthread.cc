@@ -131,6 +131,18 @@ void *Worker1( void * ) {
 	return (void *)0;
 } // Worker1
 
+pthread_mutex_t detachedLock = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t detachedDone = PTHREAD_COND_INITIALIZER;
+int detachedCount = 0;
+
+void *Detached( void * ) {								// many short detached threads, deleted in batches
+	pthread_mutex_lock( &detachedLock );
+	detachedCount += 1;
+	pthread_cond_signal( &detachedDone );
+	pthread_mutex_unlock( &detachedLock );
+	return (void *)0;
+} // Detached
+
 void *Worker2( void * ) {
     pthread_key_t key[PTHREAD_KEYS_MAX];
     unsigned long int i;
@@ -349,6 +361,20 @@ int main() {
 		exit( EXIT_FAILURE );
 	} // if
 
+	const int NoOfDetached = 5000;
+	pthread_attr_setstacksize( &attr, 32 * 1000 );
+	for ( int i = 0; i < NoOfDetached; i += 1 ) {
+		pthread_t detached;
+		if ( pthread_create( &detached, &attr, Detached, nullptr ) != 0 ) {
+			cout << "create thread failure" << endl;
+			exit( EXIT_FAILURE );
+		} // if
+	} // for
+	pthread_mutex_lock( &detachedLock );
+	while ( detachedCount != NoOfDetached ) pthread_cond_wait( &detachedDone, &detachedLock );
+	pthread_mutex_unlock( &detachedLock );
+	cout << "detached threads:" << detachedCount << endl;
+
 	pthread_attr_destroy( &attr );
 
 	// thread specific data test
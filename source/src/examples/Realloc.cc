@@ -0,0 +1,84 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// Realloc.cc -- Grow buffers by doubling, checking contents and zero fill are preserved whether realloc extends a
+//     bucket block in place, remaps a large block, or copies.
+//
+// Author           :
+// Created On       : Sun Oct 18 14:52:10 2026
+// Last Modified By :
+// Last Modified On : Sun Oct 18 14:52:10 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+#include <malloc.h>
+#include <cstring>					// memset
+#include <iostream>
+using std::cout;
+using std::endl;
+
+void check( const unsigned char *buf, size_t size ) {	// each byte holds the low bits of its position / 4096
+    for ( size_t i = 0; i < size; i += 1 ) {
+	if ( buf[i] != (unsigned char)(i / 4096) ) {
+	    cout << "content lost at " << i << " of " << size << endl;
+	    abort();
+	} // if
+    } // for
+} // check
+
+void fill( unsigned char *buf, size_t from, size_t to ) {
+    for ( size_t i = from; i < to; i += 1 ) buf[i] = i / 4096;
+} // fill
+
+int main() {
+    enum { Max = 256 * 1024 * 1024 };
+
+    unsigned char *buf = (unsigned char *)malloc( 16 );	// bucket sizes, then past the mmap crossover
+    fill( buf, 0, 16 );
+    for ( size_t size = 16; size < Max; size *= 2 ) {
+	buf = (unsigned char *)realloc( buf, size * 2 );
+	check( buf, size );
+	fill( buf, size, size * 2 );
+    } // for
+    for ( size_t size = Max; size > 16; size /= 2 ) {	// shrink back through mremap and into buckets
+	buf = (unsigned char *)realloc( buf, size / 2 );
+	check( buf, size / 2 );
+    } // for
+    free( buf );
+
+    buf = (unsigned char *)calloc( 1, 1000 );		// zero fill survives growth
+    for ( size_t size = 1000; size < 64 * 1024 * 1024; size *= 4 ) {
+	buf = (unsigned char *)realloc( buf, size * 4 );
+	for ( size_t i = 0; i < size * 4; i += 1 ) assert( buf[i] == 0 );
+    } // for
+    free( buf );
+
+    buf = (unsigned char *)memalign( 4096, 1024 * 1024 ); // page alignment survives mremap
+    fill( buf, 0, 1024 * 1024 );
+    buf = (unsigned char *)realloc( buf, 64 * 1024 * 1024 );
+    assert( ((uintptr_t)buf & 4095) == 0 );
+    check( buf, 1024 * 1024 );
+    free( buf );
+
+    malloc_stats();
+    cout << "successful completion" << endl;
+} // main
+
+
+// Local Variables: //
+// compile-command: "u++ Realloc.cc" //
+// End: //
@@ -0,0 +1,133 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// RingBuffer.cc -- Producers and consumers exchange single and batched elements through a lock-free ring buffer,
+//     checking no element is lost or duplicated, and compare throughput with the monitor bounded buffer.
+//
+// Author           :
+// Created On       : Sun Oct 18 14:02:51 2026
+// Last Modified By :
+// Last Modified On : Sun Oct 18 14:02:51 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+#include <uRingBuffer.h>
+#include <uBoundedBuffer.h>
+#include <iostream>
+using std::cout;
+using std::endl;
+
+enum { Prods = 4, Cons = 4, Items = 200000, Batch = 8, Size = 16 };
+
+template<typename Buffer> _Task Producer {
+    Buffer &buf;
+
+    void main() {
+	for ( long i = 1; i <= Items; i += 1 ) {
+	    buf.insert( i );
+	} // for
+    } // Producer::main
+  public:
+    Producer( Buffer &buf ) : buf( buf ) {}
+}; // Producer
+
+template<typename Buffer> _Task Consumer {
+    Buffer &buf;
+    long &sum;
+
+    void main() {
+	for ( ;; ) {
+	    long item = buf.remove();
+	  if ( item == -1 ) break;
+	    sum += item;
+	} // for
+    } // Consumer::main
+  public:
+    Consumer( Buffer &buf, long &sum ) : buf( buf ), sum( sum ) {}
+}; // Consumer
+
+_Task BatchProducer {
+    uRingBuffer<long> &buf;
+
+    void main() {
+	long items[Batch];
+	for ( long i = 1; i <= Items; ) {
+	    int n;
+	    for ( n = 0; n < Batch && i <= Items; n += 1, i += 1 ) items[n] = i;
+	    buf.insert( items, n );
+	} // for
+    } // BatchProducer::main
+  public:
+    BatchProducer( uRingBuffer<long> &buf ) : buf( buf ) {}
+}; // BatchProducer
+
+_Task BatchConsumer {
+    uRingBuffer<long> &buf;
+    long &sum;
+
+    void main() {
+	long items[Batch];
+	for ( ;; ) {
+	    size_t n = buf.remove( items, Batch );
+	    int stop = 0;
+	    for ( size_t i = 0; i < n; i += 1 ) {
+		if ( items[i] == -1 ) stop += 1;
+		else sum += items[i];
+	    } // for
+	  if ( stop != 0 ) {
+		for ( ; stop > 1; stop -= 1 ) buf.insert( -1 ); // leave extra sentinels for other consumers
+		break;
+	    } // exit
+	} // for
+    } // BatchConsumer::main
+  public:
+    BatchConsumer( uRingBuffer<long> &buf, long &sum ) : buf( buf ), sum( sum ) {}
+}; // BatchConsumer
+
+template<typename Buffer, typename Prod, typename Con> void run( Buffer &buf, const char *name ) {
+    long sums[Cons] = { 0 }, total = 0;
+    uTime start = uClock::currTime();
+    {
+	Con *cons[Cons];
+	for ( int i = 0; i < Cons; i += 1 ) cons[i] = new Con( buf, sums[i] );
+	Prod *prods[Prods];
+	for ( int i = 0; i < Prods; i += 1 ) prods[i] = new Prod( buf );
+	for ( int i = 0; i < Prods; i += 1 ) delete prods[i];
+	for ( int i = 0; i < Cons; i += 1 ) buf.insert( -1 );
+	for ( int i = 0; i < Cons; i += 1 ) delete cons[i];
+    }
+    double secs = (uClock::currTime() - start).nanoseconds() / 1.0E9;
+    for ( int i = 0; i < Cons; i += 1 ) total += sums[i];
+    assert( total == (long)Prods * Items * (Items + 1) / 2 );
+    cout << name << " " << (long)(Prods * Items / secs) << " items/s" << endl;
+} // run
+
+int main() {
+    uProcessor p[3] __attribute__(( unused ));		// extra processors => true concurrency
+    uRingBuffer<long> ring( Size );
+    uBoundedBuffer<long> monitor( Size );
+    run<uRingBuffer<long>, Producer<uRingBuffer<long>>, Consumer<uRingBuffer<long>>>( ring, "ring" );
+    run<uRingBuffer<long>, BatchProducer, BatchConsumer>( ring, "ring batch" );
+    run<uBoundedBuffer<long>, Producer<uBoundedBuffer<long>>, Consumer<uBoundedBuffer<long>>>( monitor, "monitor" );
+    assert( ring.query() == 0 );
+    cout << "successful completion" << endl;
+} // main
+
+
+// Local Variables: //
+// compile-command: "u++ -O2 -multi RingBuffer.cc" //
+// End: //
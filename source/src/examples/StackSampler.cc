@@ -0,0 +1,107 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// StackSampler.cc -- Sample tasks spinning on the CPU and tasks blocked on a semaphore, and check CPU and blocked
+//     time are attributed to the right tasks in folded-stack output.
+//
+// Author           :
+// Created On       : Mon Oct 19 09:12:48 2026
+// Last Modified By :
+// Last Modified On : Mon Oct 19 09:12:48 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+#include <iostream>
+#include <sstream>
+#include <string>
+using namespace std;
+#include <uStackSampler.h>
+#include <uSemaphore.h>
+
+enum { Spinners = 2, Waiters = 4 };
+volatile bool stopSpin = false;
+
+_Task Spinner {
+    void main() {
+	volatile unsigned long int sum = 0;
+	while ( ! stopSpin ) {				// consume CPU time
+	    for ( unsigned int i = 0; i < 100000; i += 1 ) sum += i;
+	    yield();					// allow other tasks on uniprocessor
+	} // while
+    } // Spinner::main
+  public:
+    Spinner() : uBaseTask( "Spinner" ) {}
+}; // Spinner
+
+_Task Waiter {
+    uSemaphore &gate;
+
+    void main() {
+	gate.P();					// off CPU until released
+    } // Waiter::main
+  public:
+    Waiter( uSemaphore &gate ) : uBaseTask( "Waiter" ), gate( gate ) {}
+}; // Waiter
+
+// Count lines of folded output beginning with task name and check each has a positive time.
+
+unsigned int lines( const string &folded, const string &task ) {
+    istringstream in( folded );
+    string line;
+    unsigned int count = 0;
+    while ( getline( in, line ) ) {
+	size_t blank = line.rfind( ' ' );
+	assert( blank != string::npos && stol( line.substr( blank + 1 ) ) > 0 );
+	if ( line.compare( 0, task.size() + 1, task + ";" ) == 0 ) count += 1;
+    } // while
+    return count;
+} // lines
+
+int main() {
+    uSemaphore gate( 0 );
+    ostringstream cpu, blocked;
+    {
+	uStackSampler sampler( uDuration( 0, 1000000 ), uDuration( 0, 5000000 ) ); // 1ms CPU, 5ms blocked
+	Waiter *waiters[Waiters];
+	for ( int i = 0; i < Waiters; i += 1 ) waiters[i] = new Waiter( gate );
+	{
+	    Spinner spinners[Spinners];
+	    uTime start = uClock::currTime();
+	    while ( sampler.samples( uStackSampler::Cpu ) < 50 || sampler.samples( uStackSampler::Blocked ) < 50 ) {
+		if ( uClock::currTime() - start > uDuration( 30 ) ) abort( "sampler collected no samples" );
+		uThisTask().sleep( uDuration( 0, 50000000 ) );
+	    } // while
+	    stopSpin = true;
+	}
+	for ( int i = 0; i < Waiters; i += 1 ) gate.V();
+	for ( int i = 0; i < Waiters; i += 1 ) delete waiters[i];
+	sampler.stop();
+	sampler.stop();					// idempotent
+	sampler.folded( cpu, uStackSampler::Cpu );
+	sampler.folded( blocked, uStackSampler::Blocked );
+	cout << "cpu samples " << sampler.samples( uStackSampler::Cpu ) << " blocked samples " << sampler.samples( uStackSampler::Blocked )
+	     << " dropped " << sampler.dropped() << endl;
+    }
+    assert( lines( cpu.str(), "Spinner" ) > 0 );
+    assert( lines( blocked.str(), "Waiter" ) > 0 && lines( blocked.str(), "Spinner" ) == 0 ); // spinners never block
+    cout << "successful completion" << endl;
+} // main
+
+
+// Local Variables: //
+// compile-command: "u++-work -g -fno-omit-frame-pointer -rdynamic StackSampler.cc" //
+// End: //
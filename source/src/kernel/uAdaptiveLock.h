@@ -253,6 +253,105 @@ template< int acquireSpins = 0, int trySpins = 0, int releaseSpins = 0 > class u
 }; // uAdaptiveLock
 
 
+// uAdaptiveOwnerLock is an owner lock, so it can be used with uCondLock, that spins before blocking for a budget tuned
+// separately for each lock. A task that acquires the lock while spinning records how many iterations the owner took to
+// finish its critical section, and the budget is twice the moving average of these counts. Spinning stops as soon as
+// the owner is not running, because the lock cannot be released until the owner is rescheduled. When spinning keeps
+// failing, critical sections are long and the budget decays to MinSpins; every Probe-th contended acquire spins for
+// MaxSpins so a lock whose critical sections become short again is noticed. Tuning state and statistics are updated
+// only by the owner, and fit with the uOwnerLock in a pthread_mutex_t.
+
+class __attribute__(( may_alias )) uAdaptiveOwnerLock : public uOwnerLock {
+    unsigned short int spinAvg;				// moving average of spins to acquire, scaled by 8
+    unsigned short int probe;				// contended acquires since last long spin
+    unsigned int acquisitions, contentions, blocks;	// statistics, wrap around
+
+    unsigned int budget() const {
+	unsigned int spins = spinAvg / 4;		// twice the average
+	return spins < MinSpins ? MinSpins : spins > MaxSpins ? MaxSpins : spins;
+    } // uAdaptiveOwnerLock::budget
+
+    void learn( unsigned int spins ) {			// acquired after spinning
+	spinAvg = spinAvg - spinAvg / 8 + spins;
+    } // uAdaptiveOwnerLock::learn
+
+    // Return the number of spins when the lock is acquired, 0 when the budget is exhausted and -1 when the owner is
+    // not running.
+
+    int spin( unsigned int limit ) {
+	for ( unsigned int spins = 1; spins <= limit; spins += 1 ) {
+	    uPause();
+	    // SKULLDUGGERY: as in uAdaptiveLock, the owner may be deleted while its state is read, which only makes this
+	    // optimization guess wrong.
+	    uBaseTask *holder = owner();
+	    if ( holder == nullptr ) {
+		if ( uOwnerLock::tryacquire() ) return spins;
+	    } else if ( holder->getState() != uBaseTask::Running ) {
+		return -1;
+	    } // if
+	} // for
+	return 0;
+    } // uAdaptiveOwnerLock::spin
+  public:
+    enum { MinSpins = 16, MaxSpins = 4000, Probe = 32 };
+
+    struct Statistics {
+	unsigned int acquisitions;			// outermost acquires
+	unsigned int contentions;			// acquires that found the lock held
+	unsigned int blocks;				// contended acquires that blocked
+	unsigned int budget;				// current spin budget
+    }; // Statistics
+
+    uAdaptiveOwnerLock() {
+	spinAvg = probe = 0;
+	acquisitions = contentions = blocks = 0;
+    } // uAdaptiveOwnerLock::uAdaptiveOwnerLock
+
+    void acquire() {
+	uBaseTask &task = uThisTask();			// optimization
+
+	uBaseTask *holder = owner();
+      if ( holder == &task ) { uOwnerLock::acquire(); return; } // recursive entry
+	if ( holder == nullptr && uOwnerLock::tryacquire() ) {
+	    acquisitions += 1;
+	    return;
+	} // if
+#ifdef __U_MULTI__
+	bool probing = probe >= Probe;
+	int spins = spin( probing ? (unsigned int)MaxSpins : budget() );
+	if ( spins > 0 ) {
+	    if ( probing ) probe = 0;
+	    else probe += 1;
+	    learn( spins );
+	    acquisitions += 1;
+	    contentions += 1;
+	    return;
+	} // if
+#endif // __U_MULTI__
+	uOwnerLock::acquire();
+	acquisitions += 1;
+	contentions += 1;
+	blocks += 1;
+#ifdef __U_MULTI__
+	if ( probing ) probe = 0;
+	else probe += 1;
+	if ( spins == 0 ) spinAvg -= spinAvg / 4;	// critical section outlasted budget
+#endif // __U_MULTI__
+    } // uAdaptiveOwnerLock::acquire
+
+    bool tryacquire() {
+	bool outer = owner() != &uThisTask();
+      if ( ! uOwnerLock::tryacquire() ) return false;
+	if ( outer ) acquisitions += 1;
+	return true;
+    } // uAdaptiveOwnerLock::tryacquire
+
+    Statistics statistics() const {			// approximate unless lock is held
+	return { acquisitions, contentions, blocks, budget() };
+    } // uAdaptiveOwnerLock::statistics
+}; // uAdaptiveOwnerLock
+
+
 // Local Variables: //
 // compile-command: "make install" //
 // End: //
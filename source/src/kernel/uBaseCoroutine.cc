@@ -139,9 +139,12 @@ void uBaseCoroutine::taskCxtSw() {			// switch between a task and the kernel
 
     errno_ = errno;					// save
     coroutine.save();					// save user specified contexts
+    currTask.switchOut = uBaseTask::cpuClock();		// charge time slice
+    currTask.execTime += currTask.switchOut - currTask.execStart;
 
     uSwitch( coroutine.context, context );		// context switch to kernel
 
+    currTask.execStart = uBaseTask::cpuClock();		// start time slice
     coroutine.restore();				// restore user specified contexts
     *errno_location() = errno_;				// restore
 
@@ -53,6 +53,12 @@ void uBaseTask::createTask( uCluster &cluster ) {
     currCluster = &cluster;				// remember the cluster task is created on
     currCoroutine = this;				// the first coroutine that a task executes is itself
     acceptedCall = nullptr;				// no accepted mutex entry yet
+    reapNext = nullptr;
+    execTime = charged = 0;
+    execStart = switchOut = cpuClock();			// boot task is already executing
+    weight = DefaultWeight;
+    vruntime = 0;
+    readyIndex = 0;
     priority = activePriority = 0;
     inheritTask = this;
 
@@ -82,6 +88,13 @@ void uBaseTask::createTask( uCluster &cluster ) {
 	heapData = nullptr;
 	uHeapControl::prepareTask( this );
     } // if
+
+    // The creating task may execute on another memory node and touches the top of the new stack, so first-touch
+    // placement is insufficient; only runtime-allocated stacks are moved.
+
+    if ( cluster.getNUMANode() != -1 && ( (uintptr_t)storage & 1 ) == 0 ) {
+	uNUMA::bind( limit, (char *)base - (char *)limit, cluster.getNUMANode() );
+    } // if
 } // uBaseTask::createTask
 
 
@@ -220,6 +233,47 @@ uBaseTask::uTaskMain::~uTaskMain() {
 } // uBaseTask::uTaskMain::~uTaskMain
 
 
+// Tick rate is measured against the monotonic clock since the program started, so no calibration delay is needed at
+// startup.
+
+static uTime monotonic() {
+    timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return uTime( ts );
+} // monotonic
+
+static const unsigned long long int startTicks = uBaseTask::cpuClock();
+static const uTime startTime = monotonic();
+
+
+uDuration uBaseTask::cpuDuration( unsigned long long int ticks ) {
+#if defined( __i386__ ) || defined( __x86_64__ )
+    double elapsed = (monotonic() - startTime).nanoseconds();
+    double rate = elapsed > 0 ? (double)(cpuClock() - startTicks) / elapsed : 1.0; // ticks per nanosecond
+    return uDuration( 0, (long int)(ticks / rate) );
+#else
+    return uDuration( 0, ticks );			// ticks are nanoseconds
+#endif // __i386__ || __x86_64__
+} // uBaseTask::cpuDuration
+
+
+uDuration uBaseTask::getExecutionTime() const {
+  if ( this != &uThisTask() ) return cpuDuration( execTime ); // time slice in progress not visible
+    THREAD_GETMEM( This )->disableInterrupts();		// no context switch while reading both fields
+    unsigned long long int ticks = execTime + cpuClock() - execStart;
+    THREAD_GETMEM( This )->enableInterrupts();
+    return cpuDuration( ticks );
+} // uBaseTask::getExecutionTime
+
+
+unsigned int uBaseTask::setWeight( unsigned int weight ) {
+    if ( weight == 0 ) abort( "(uBaseTask &)%p.setWeight : weight must be greater than 0.", this );
+    unsigned int prev = uBaseTask::weight;
+    uBaseTask::weight = weight;				// takes effect when the task is next charged
+    return prev;
+} // uBaseTask::setWeight
+
+
 void uBaseTask::wake() {
     setState( Ready );					// task is marked available for execution
     currCluster->makeTaskReady( *this );		// put the task on the ready queue of the cluster
@@ -66,6 +66,9 @@ unsigned long int Statistics::accept_syscalls = 0, Statistics::accept_errors = 0
 unsigned long int Statistics::read_syscalls = 0, Statistics::read_errors = 0, Statistics::read_eagain = 0, Statistics::read_chunking = 0, Statistics::read_bytes = 0;
 unsigned long int Statistics::write_syscalls = 0, Statistics::write_errors = 0, Statistics::write_eagain = 0, Statistics::write_bytes = 0;
 unsigned long int Statistics::sendfile_syscalls = 0, Statistics::sendfile_errors = 0, Statistics::sendfile_eagain = 0, Statistics::first_sendfile = 0, Statistics::sendfile_yields = 0;
+unsigned long int Statistics::mmsg_syscalls = 0, Statistics::mmsg_eagain = 0, Statistics::mmsg_messages = 0;
+unsigned long int Statistics::splice_syscalls = 0, Statistics::splice_eagain = 0, Statistics::splice_bytes = 0;
+unsigned long int Statistics::zerocopy_sends = 0, Statistics::zerocopy_completions = 0, Statistics::zerocopy_copied = 0;
 
 unsigned long int Statistics::iopoller_exchange = 0, Statistics::iopoller_spin = 0;
 unsigned long int Statistics::signal_alarm = 0, Statistics::signal_usr1 = 0;
@@ -181,6 +184,30 @@ void UPP::Statistics::print() {
 		    Statistics::iopoller_spin );
     uDebugWrite( STDOUT_FILENO, helpText, len );
 
+    len = snprintf( helpText, 512,
+		    "  send/recvmmsg:"
+		    " calls %ld"
+		    " / eagain %ld"
+		    " / messages %ld\n"
+		    "  splice/tee:"
+		    " calls %ld"
+		    " / eagain %ld"
+		    " / bytes %ld\n"
+		    "  zerocopy:"
+		    " sends %ld"
+		    " / completions %ld"
+		    " / copied %ld\n",
+		    Statistics::mmsg_syscalls,
+		    Statistics::mmsg_eagain,
+		    Statistics::mmsg_messages,
+		    Statistics::splice_syscalls,
+		    Statistics::splice_eagain,
+		    Statistics::splice_bytes,
+		    Statistics::zerocopy_sends,
+		    Statistics::zerocopy_completions,
+		    Statistics::zerocopy_copied );
+    uDebugWrite( STDOUT_FILENO, helpText, len );
+
     len = snprintf( helpText, 512,
 		    "\nScheduler statistics:\n"
 		    "  coroutine context switches: %ld\n"
@@ -842,6 +869,26 @@ bool uBaseScheduleFriend::checkHookConditions( uBaseTask &task1, uBaseTask &task
     return task2.getSerial().checkHookConditions( &task1 );
 } // uBaseScheduleFriend::checkHookConditions
 
+unsigned long long int uBaseScheduleFriend::getExecutionTicks( uBaseTask &task ) const {
+    return task.execTime;				// task is not running when on a ready queue
+} // uBaseScheduleFriend::getExecutionTicks
+
+uTime uBaseScheduleFriend::getSwitchOut( uBaseTask &task ) const {
+    return uClock::currTime() - uBaseTask::cpuDuration( uBaseTask::cpuClock() - task.switchOut ); // ticks ago
+} // uBaseScheduleFriend::getSwitchOut
+
+unsigned long long int &uBaseScheduleFriend::virtualTime( uBaseTask &task ) const {
+    return task.vruntime;
+} // uBaseScheduleFriend::virtualTime
+
+unsigned long long int &uBaseScheduleFriend::chargedTicks( uBaseTask &task ) const {
+    return task.charged;
+} // uBaseScheduleFriend::chargedTicks
+
+int &uBaseScheduleFriend::readyIndex( uBaseTask &task ) {
+    return task.readyIndex;
+} // uBaseScheduleFriend::readyIndex
+
 
 //######################### uBasePrioritySeq #########################
 
@@ -104,6 +104,7 @@
 #include <ucontext.h>					// ucontext_t
 
 #include <exception>
+#include <new>						// std::align_val_t
 #include <iosfwd>					// std::filebuf
 #include <pthread.h>					// PTHREAD_CANCEL_*
 #include <unwind-cxx.h>					// struct __cxa_eh_globals
@@ -189,6 +190,9 @@ void * realloc( void * addr, size_t alignment, size_t size ) __THROW;
 #ifndef M_TOP_PAD
 #define M_TOP_PAD (-2)
 #endif // M_TOP_PAD
+#ifndef M_TRIM_THRESHOLD
+#define M_TRIM_THRESHOLD (-3)
+#endif // M_TRIM_THRESHOLD
 
 
 #ifdef __U_STATISTICS__
@@ -206,6 +210,9 @@ namespace UPP {
 	static unsigned long int read_syscalls, read_errors, read_eagain, read_chunking, read_bytes;
 	static unsigned long int write_syscalls, write_errors, write_eagain, write_bytes;
 	static unsigned long int sendfile_syscalls, sendfile_errors, sendfile_eagain, first_sendfile, sendfile_yields;
+	static unsigned long int mmsg_syscalls, mmsg_eagain, mmsg_messages;
+	static unsigned long int splice_syscalls, splice_eagain, splice_bytes;
+	static unsigned long int zerocopy_sends, zerocopy_completions, zerocopy_copied;
 
 	static unsigned long int iopoller_exchange, iopoller_spin;
 	static unsigned long int signal_alarm, signal_usr1;
@@ -246,6 +253,7 @@ namespace UPP {
 #define _Cormonitor _Mutex _Coroutine			// short form for coroutine monitor
 
 _Task uSystemTask;					// forward declaration
+_Task uElasticProcessors;				// forward declaration
 class uBaseCoroutine;					// forward declaration
 class __attribute__(( may_alias )) uBaseTask;		// forward declaration
 class uBaseSpinLock;					// forward declaration
@@ -283,6 +291,7 @@ namespace UPP {
     class PthreadLock;					// forward declaration
     _Coroutine uProcessorKernel;			// forward declaration
     class uNBIO;					// forward declaration
+    class uReapList;					// forward declaration
     void umainProfile();				// forward declaration
 } // UPP
 
@@ -300,6 +309,7 @@ class uProfilerBoot;
 class uProfileTaskSampler;
 class uProfileClusterSampler;
 class uProfileProcessorSampler;
+class uStackSampler;
 
 extern "C" {
     void __cyg_profile_func_enter( void *pcCurrentFunction, void *pcCallingFunction );
@@ -324,6 +334,7 @@ namespace UPP {
     class uSigHandlerModule {
 	friend class uKernelBoot;			// access: uSigHandlerModule
 	friend _Task ::uLocalDebugger;			// access: signal
+	friend class ::uStackSampler;			// access: signal
 #ifdef __U_PROFILER__
 	friend _Task ::uProfiler;			// access: signal, signalContextPC
 #endif // __U_PROFILER__
@@ -423,6 +434,8 @@ class uKernelModule {
     friend class uCluster;				// access: uKernelModuleBoot, globalClusters, globalClusterLock, rollForward
     friend _Task UPP::uBootTask;			// access: uKernelModuleBoot, systemCluster
     friend _Task uSystemTask;				// access: systemCluster
+    friend _Task uElasticProcessors;			// access: systemCluster
+    friend class UPP::uReapList;			// access: globalProcessorLock, globalProcessors
     friend void UPP::umainProfile();			// access: bootTask
     friend class UPP::uKernelBoot;			// access: everything
     friend class UPP::uInitProcessorsBoot;		// access: numUserProcessors, userProcessors
@@ -457,6 +470,7 @@ class uKernelModule {
 
     friend class uKernelSampler;			// access: globalClusters
     friend class uClusterSampler;			// access: globalClusters
+    friend class uStackSampler;				// access: globalClusters, globalClusterLock, systemTask
     friend __typeof__( ::dl_iterate_phdr ) dl_iterate_phdr; // access: disableInterrupts, enableInterrupts
 
     struct uKernelModuleData {
@@ -1066,14 +1080,77 @@ class uFloatingPointContext {
 extern "C" void uSwitch( void *from, void *to ) asm ("uSwitch"); // assembler routine that performs the context switch
 
 
+namespace UPP {
+    // Each processor caches recently freed task and coroutine stacks and task objects, so a processor spawning short
+    // tasks reuses them without the heap and, in debug mode, without re-protecting the stack guard page. A block is
+    // reused only for an identical size, and a processor's cache is accessed with interrupts disabled so the task cannot
+    // migrate in the middle of an operation. Only raw storage is reused; constructors and destructors run as usual.
+
+    class uTaskPool {
+	friend class uMachContext;			// access: get, put, Stacks
+	friend class ::uBaseTask;			// access: get, put, Tasks
+	friend class ::uProcessor;			// access: uTaskPool, close
+
+	struct Block {					// header written into a cached block
+	    Block *next;
+	    size_t size;
+	}; // Block
+
+	enum { Stacks, Tasks, Kinds };
+	static const unsigned int Limits[Kinds];	// maximum blocks cached per processor
+
+	Block *top[Kinds];
+	unsigned int count[Kinds];
+	bool open;					// zero-filled storage => not caching
+
+	static void *get( unsigned int kind, size_t size ); // nullptr => allocate
+	static bool put( unsigned int kind, void *block, size_t size ); // false => free
+
+	uTaskPool();
+	void close();					// free cached blocks and stop caching
+    }; // uTaskPool
+
+
+    // A task that deletes itself when it finishes, e.g., a detached pthread, is put on the reap list of the processor it
+    // finishes on, instead of a rendezvous with the system task. When a list reaches Batch tasks, the next task
+    // finishing on that processor deletes the batch before putting itself on the list, so storage is freed locally and
+    // back into the processor's task pool. So a quiet processor does not hold finished tasks indefinitely, the system
+    // task periodically deletes lists whose oldest task finished more than MaxAge seconds ago. Remaining tasks are
+    // deleted when the processor is deleted.
+
+    class uReapList {
+	friend class ::uProcessor;			// access: uReapList, close
+	friend _Task ::uSystemTask;			// access: defer, sweep, MaxAge
+	friend _Task uPthread;				// access: defer
+
+	enum { Batch = 16, MaxAge = 1 };		// tasks deleted together, seconds a deferred task may wait
+
+	uSpinLock lock;					// processor defers, system task sweeps
+	uBaseTask *top;					// linked through uBaseTask::reapNext
+	unsigned int count;
+	uTime since;					// when oldest task on list was deferred
+	bool open;					// zero-filled storage => not deferring
+
+	static bool defer( uBaseTask &victim );		// false => use system task
+	static void reap( uBaseTask *list );
+	static void sweep();				// delete lists older than MaxAge
+
+	uReapList();
+	void close();					// delete deferred tasks and stop deferring
+    }; // uReapList
+} // UPP
+
+
 // Contains the machine dependent context and routines that initialize and switch between contexts.
 
 namespace UPP {
     class uMachContext {
+	friend class uTaskPool;				// access: freeStorage, stackOffset
 	friend class ::uContext;			// access: extras, additionalContexts
+	friend class ::uStackSampler;			// access: context, limit, base
 	friend class ::uProcessorTask;			// access: size, base, limit
 	friend class ::uBaseCoroutine;			// access: storage
-	friend class ::uBaseTask;			// access: context
+	friend class ::uBaseTask;			// access: context, storage, limit, base
 	friend _Coroutine uProcessorKernel;		// access: storage
 	friend class ::uProcessor;			// access: storage
 	friend class uKernelBoot;			// access: storage
@@ -1101,6 +1178,8 @@ namespace UPP {
 	} extras;					// indicates extra work during the context switch
 
 	void createContext( unsigned int stackSize );	// used by all constructors
+	static size_t stackOffset();			// guard page before cached stack block
+	static void freeStorage( void *storage );
 
 	void startHere( void (*uInvoke)( uMachContext & ) );
       protected:
@@ -1149,16 +1228,7 @@ namespace UPP {
 	    createContext( storageSize );
 	} // uMachContext::uMachContext
 
-	virtual ~uMachContext() {
-	    if ( ! ((uintptr_t)storage & 1) ) {		// check user stack storage mark
-		uDEBUG(
-		    if ( ::mprotect( storage, pageSize, PROT_READ | PROT_WRITE ) == -1 ) {
-			abort( "(uMachContext &)%p.~uMachContext() : internal error, mprotect failure, error(%d) %s.", this, errno, strerror( errno ) );
-		    } // if
-		)
-		free( storage );
-	    } // if
-	} // uMachContext::~uMachContext
+	virtual ~uMachContext();
 
 	void *stackPointer() const;
 
@@ -1467,6 +1537,11 @@ class uBaseScheduleFriend {
     int setBaseQueue( uBaseTask &task, int priority );
     bool isEntryBlocked( uBaseTask &task ) const;
     bool checkHookConditions( uBaseTask &task1, uBaseTask &task2 ) const;
+    unsigned long long int getExecutionTicks( uBaseTask &task ) const;
+    uTime getSwitchOut( uBaseTask &task ) const;
+    unsigned long long int &virtualTime( uBaseTask &task ) const;
+    unsigned long long int &chargedTicks( uBaseTask &task ) const;
+    static int &readyIndex( uBaseTask &task );
 }; // uBaseScheduleFriend
 
 
@@ -1656,8 +1731,8 @@ class uBaseTask : public uBaseCoroutine {
     friend class UPP::uSerial;				// access: everything
     friend class UPP::uSerialConstructor;		// access: profileActive, setSerial
     friend class UPP::uSerialDestructor;		// access: mutexRef, profileActive, mutexRecursion, setState
-    friend class UPP::uMachContext;			// access: currCoroutine, profileActive, setState, main
-    friend class uBaseCoroutine;			// access: currCoroutine, profileActive, setState
+    friend class UPP::uMachContext;			// access: currCoroutine, profileActive, setState, main, execStart
+    friend class uBaseCoroutine;			// access: currCoroutine, profileActive, setState, execTime, execStart, switchOut
     friend uBaseCoroutine &uThisCoroutine();		// access: currCoroutine
     friend class uOwnerLock;				// access: entryRef, profileActive, wake
     template< int, int, int > friend class uAdaptiveLock; // access: entryRef, profileActive, wake
@@ -1676,6 +1751,7 @@ class uBaseTask : public uBaseCoroutine {
     friend void *memalign( size_t alignment, size_t size ) __THROW; // access: profileActive
     friend class uEventList;				// access: profileActive
     friend class UPP::uHeapControl;			// access: heapData
+    friend class UPP::uReapList;			// access: reapNext
     friend class uEventListPop;				// access: currCluster
 #ifdef KNOT
     friend int pthread_mutex_lock( pthread_mutex_t *mutex ) __THROW; // access: setActivePriority
@@ -1692,6 +1768,7 @@ class uBaseTask : public uBaseCoroutine {
 
     friend class uLocalDebuggerHandler;			// access: taskDebugMask, processBP
     friend _Task uLocalDebugger;			// access: bound, taskDebugMask, debugPCandSRR
+    friend class uStackSampler;				// access: currCoroutine, bound
     friend class UPP::uSigHandlerModule;		// access: debugPCandSRR
 
 #ifdef __U_PROFILER__
@@ -1733,6 +1810,16 @@ class uBaseTask : public uBaseCoroutine {
     uProcessor &bound;					// processor to which this task is bound, if applicable
     uBasePrioritySeq *calledEntryMem;			// pointer to called mutex queue
     uOwnerLock *ownerLock;				// pointer to owner lock used for signalling conditions
+    uBaseTask *reapNext;				// link on processor reap list
+
+    // execution-time accounting and fair share
+
+    unsigned long long int execTime;			// accumulated execution ticks, updated at context switches
+    unsigned long long int execStart, switchOut;	// tick count at last switch in and out
+    unsigned int weight;				// processor share relative to DefaultWeight
+    unsigned long long int vruntime;			// virtual time in nanoseconds for fair-share scheduling
+    unsigned long long int charged;			// execTime already added to vruntime
+    int readyIndex;					// subscript in a fair-share ready heap
 
     // profiling : necessary for compatibility between non-profiling and profiling
 
@@ -1869,6 +1956,31 @@ class uBaseTask : public uBaseCoroutine {
     ~uBaseTask() {
     } // uBaseTask::~uBaseTask
 
+    void *operator new( size_t size ) {			// task objects are cached per processor
+	void *addr = UPP::uTaskPool::get( UPP::uTaskPool::Tasks, size );
+	return addr != nullptr ? addr : ::operator new( size );
+    } // uBaseTask::operator new
+
+    void *operator new( size_t, void *storage ) {
+	return storage;
+    } // uBaseTask::operator new
+
+    void operator delete( void *addr, size_t size ) {
+	if ( ! UPP::uTaskPool::put( UPP::uTaskPool::Tasks, addr, size ) ) ::operator delete( addr );
+    } // uBaseTask::operator delete
+
+#ifdef __cpp_aligned_new
+    // Cached objects only have the default new alignment, so over-aligned tasks (e.g., CALIGN members) bypass the cache.
+
+    void *operator new( size_t size, std::align_val_t align ) {
+	return ::operator new( size, align );
+    } // uBaseTask::operator new
+
+    void operator delete( void *addr, size_t, std::align_val_t align ) {
+	::operator delete( addr, align );
+    } // uBaseTask::operator delete
+#endif // __cpp_aligned_new
+
     static void yield() {
 	uThisTask().uYieldNoPoll();
 	asyncpoll();
@@ -1897,6 +2009,31 @@ class uBaseTask : public uBaseCoroutine {
 	return state;
     } // uBaseTask::getState
 
+    // Execution time is accounted in ticks when a task switches to the kernel, so the value for a task running on
+    // another processor excludes its current time slice. Ticks are the time-stamp counter on x86, which is cheap to read
+    // and unaffected by wall-clock adjustment, and nanoseconds of CLOCK_MONOTONIC elsewhere.
+
+    enum { DefaultWeight = 1024 };
+
+    static unsigned long long int cpuClock() {		// cheap monotonic tick count
+#if defined( __i386__ ) || defined( __x86_64__ )
+	return uRdtsc();
+#else
+	timespec ts;
+	clock_gettime( CLOCK_MONOTONIC, &ts );
+	return (unsigned long long int)ts.tv_sec * 1000000000 + ts.tv_nsec; // nanoseconds
+#endif // __i386__ || __x86_64__
+    } // uBaseTask::cpuClock
+
+    static uDuration cpuDuration( unsigned long long int ticks ); // convert ticks to time
+    uDuration getExecutionTime() const;
+
+    unsigned int getWeight() const {
+	return weight;
+    } // uBaseTask::getWeight
+
+    unsigned int setWeight( unsigned int weight );
+
     int getActivePriority() const {
 	// special case for base of active priority stack
 	return this == inheritTask ? priority : activePriority;
@@ -2470,6 +2607,8 @@ class uProcessor {
     friend class uEventListPop;                         // access: contextSwitchHandler
     friend void *uKernelModule::startThread( void *p ); // acesss: everything
     friend class UPP::uMachContext;			// access: procTask
+    friend class UPP::uTaskPool;			// access: pool
+    friend class UPP::uReapList;			// access: reap
 //#if defined( __i386__ ) && ! defined( __old_perfmon__ )
 //    friend class HWCounters;				// access: uPerfctrContext (i386) or uPerfmon_fd (ia64)
 //#endif
@@ -2488,6 +2627,7 @@ class uProcessor {
 #endif // __U_PROFILER__
 
     static uEventList *events;				// single list of events for all processors
+    static unsigned int nextId;				// next processor id, protected by globalProcessorLock
 #if ! defined( __U_MULTI__ )
     static						// shared info on uniprocessor
 #endif // ! __U_MULTI__
@@ -2515,6 +2655,7 @@ class uProcessor {
     } // uProcessor::operator new
   protected:
     uPid_t pid;
+    unsigned int id;					// dense processor number starting at 0
 
     unsigned int preemption;
     unsigned int spin;
@@ -2527,6 +2668,9 @@ class uProcessor {
     bool detached;					// processor detached ?
     bool terminated;                                    // processor being deleted ?
 
+    UPP::uTaskPool pool;				// freed stacks and task objects for reuse on this processor
+    UPP::uReapList reap;				// finished tasks deleted in batches on this processor
+
     uProcessorDL idleRef;				// double link field: list of idle processors
     uProcessorDL processorRef;				// double link field: list of processors on a cluster
     uProcessorDL globalRef;				// double link field: list of all processors
@@ -2552,6 +2696,10 @@ class uProcessor {
 	return pid;
     } // uProcessor::getPid
 
+    unsigned int getId() const {
+	return id;
+    } // uProcessor::getId
+
     uCluster &setCluster( uCluster &cluster );
 
     uCluster &getCluster() const {
@@ -2617,6 +2765,24 @@ namespace UPP {
 } // UPP
 
 
+//######################### uNUMA #########################
+
+
+// Memory-node topology read from /sys/devices/system/node. On a machine without NUMA support, there is a single node 0
+// containing all CPUs.
+
+class uNUMA {
+  public:
+    static unsigned int nodes();			// number of memory nodes
+    static int nodeOf( unsigned int cpu );		// node containing cpu, -1 => unknown cpu
+    static int currentNode();				// node of the CPU executing the caller
+#if defined( __U_AFFINITY__ )
+    static bool cpus( unsigned int node, cpu_set_t &mask ); // CPUs of node, false => unknown node
+#endif // __U_AFFINITY__
+    static int bind( void *addr, size_t len, unsigned int node ); // prefer node for pages of [addr,addr+len), -1 => errno
+}; // uNUMA
+
+
 //######################### uCluster (cont) #########################
 
 
@@ -2632,13 +2798,15 @@ class uCluster {
     friend class UPP::uNBIO::uSelectTimeoutHndlr;	// access: NBIO, wakeProcessor
     friend class UPP::uKernelBoot;			// access: new, NBIO, taskAdd, taskRemove
     friend _Coroutine UPP::uProcessorKernel;		// access: NBIO, readyQueueTryRemove, readyQueueEmpty, tasksOnCluster, makeProcessorActive, processorPause
-    friend _Task uProcessorTask;			// access: processorAdd, processorRemove
+    friend _Task uProcessorTask;			// access: processorAdd, processorRemove, numaPin
     friend class uProcessor;				// access: processorAdd, processorRemove
+    friend void *uKernelModule::startThread( void *p );	// access: numaPin
     friend class uRealTimeBaseTask;			// access: taskReschedule
     friend class uPeriodicBaseTask;			// access: taskReschedule
     friend class uSporadicBaseTask;			// access: taskReschedule
     friend struct uIOClosure;				// access: select
     friend class uRWLock;				// access: makeTaskReady
+    friend class uStackSampler;				// access: readyIdleTaskLock, tasksOnCluster
 
     // must be first field for alignment
     uSpinLock readyIdleTaskLock;			// protect readyQueue, idleProcessors and tasksOnCluster
@@ -2672,11 +2840,17 @@ class uCluster {
     uBaseSchedule<uBaseTaskDL> *readyQueue;		// list of tasks awaiting execution by processors on this cluster
     bool defaultReadyQueue;				// indicates if the cluster allocated the ready queue
     unsigned int idleProcessorsCnt;			// number of idle processors
+    unsigned int readyTasks;				// length of ready queue, excluding tasks bound to a processor
+    unsigned long int parks, wakes;			// processors paused for lack of work and woken for work
     uProcessorSeq idleProcessors;			// list of idle processors associated with this cluster
     uBaseTaskSeq tasksOnCluster;			// list of tasks on this cluster
     uProcessorSeq processorsOnCluster;			// list of processors associated with this cluster
     unsigned int numProcessors;				// number of processors on cluster
     unsigned int stackSize;				// default stack size for tasks created on cluster
+    int numaNode;					// memory node for processors, stacks and mmapped storage, -1 => unbound
+    uSpinLock admissionLock;				// protect utilization
+    double utilization;					// sum of cost/period of admitted real-time work
+    double utilizationBound;				// admission limit, 0 => number of processors on cluster
 
     uClusterDL wakeupList;				// double link field: list of clusters with wakeups
 
@@ -2713,6 +2887,7 @@ class uCluster {
     void processorPoke();
 #endif // __U_MULTI__
     void createCluster( unsigned int stackSize, const char *name );
+    void numaPin();
 
     int select( uIOClosure &closure, int rwe, timeval *timeout = nullptr ) {
 	return NBIO->select( closure, rwe, timeout );
@@ -2752,6 +2927,20 @@ class uCluster {
 	return stackSize;
     } // uCluster::getStackSize
 
+    int setNUMANode( int node );
+
+    int getNUMANode() const {
+	return numaNode;
+    } // uCluster::getNUMANode
+
+    bool admit( uDuration cost, uDuration period );
+    void withdraw( uDuration cost, uDuration period );
+    double setUtilizationBound( double bound );
+
+    double getUtilization() const {
+	return utilization;
+    } // uCluster::getUtilization
+
     void taskResetPriority( uBaseTask &owner, uBaseTask &calling );
     void taskSetPriority( uBaseTask &owner, uBaseTask &calling );
 
@@ -2771,6 +2960,22 @@ class uCluster {
 	return numProcessors;
     } // uCluster::getProcessors
 
+    unsigned int getIdleProcessors() const {
+	return idleProcessorsCnt;
+    } // uCluster::getIdleProcessors
+
+    unsigned int getReadyTasks() const {
+	return readyTasks;
+    } // uCluster::getReadyTasks
+
+    unsigned long int getParks() const {
+	return parks;
+    } // uCluster::getParks
+
+    unsigned long int getWakes() const {
+	return wakes;
+    } // uCluster::getWakes
+
     const uProcessorSeq &getProcessorsOnCluster() {
 	return processorsOnCluster;
     } // uCluster::getProcessorsOnCluster
@@ -35,6 +35,8 @@
 #endif // __U_PROFILER__
 //#include <uDebug.h>
 
+#include <cstring>					// strerror
+
 
 using namespace UPP;
 
@@ -112,6 +114,7 @@ void uCluster::processorPause() {
 	    uDEBUGPRT( uDebugPrt( "(uCluster &)%p.processorPause, after sigpause\n", this ); )
 
 	    makeProcessorActive( uThisProcessor() );
+	    uFetchAdd( wakes, 1 );
 	} // if
     } // if
 
@@ -131,6 +134,7 @@ void uCluster::processorPause() {
 void uCluster::makeProcessorIdle( uProcessor &processor ) {
     assert( readyIdleTaskLock.value != 0 );		// readyIdleTaskLock must be acquired
     idleProcessorsCnt += 1;
+    parks += 1;
     idleProcessors.addTail( &(processor.idleRef) );
 } // uCluster::makeProcessorIdle
 
@@ -186,6 +190,7 @@ void uCluster::makeTaskReady( uBaseTask &readyTask ) {
 	uDEBUGPRT( uDebugPrt( "(uCluster &)%p.makeTaskReady(2): task %.256s (%p) makes task %.256s (%p) ready\n",
 			      this, uThisTask().getName(), &uThisTask(), readyTask.getName(), &readyTask ); )
 	readyQueue->add( &(readyTask.readyRef) );	// add task to end of cluster ready queue
+	readyTasks += 1;
 #ifdef __U_MULTI__
 	// Wake up an idle processor if the ready task is migrating to another cluster with idle processors or if the
 	// ready task is on the same cluster but the ready queue of that cluster is not empty. This check prevents a
@@ -207,7 +212,7 @@ void uCluster::makeTaskReady( uBaseTask &readyTask ) {
 } // uCluster::makeTaskReady
 
 
-void uCluster::makeTaskReady( uBaseTaskSeq &newTasks, unsigned int n __attribute__(( unused )) ) {
+void uCluster::makeTaskReady( uBaseTaskSeq &newTasks, unsigned int n ) {
     readyIdleTaskLock.acquire();
     // cannot be bound task as all tasks come from RW lock
     uDEBUGPRT( uDebugPrt( "(uCluster &)%p.makeTaskReady(2): task %.256s (%p) tasks ready\n",
@@ -217,6 +222,7 @@ void uCluster::makeTaskReady( uBaseTaskSeq &newTasks, unsigned int n __attribute
     uFetchAdd( UPP::Statistics::ready_queue, n );
 #endif // __U_STATISTICS__
     readyQueue->transfer( newTasks );			// add task(s) to end of cluster ready queue
+    readyTasks += n;
 
 #ifdef __U_MULTI__
     // Wake up an idle processor if the ready task is migrating to another cluster with idle processors or if the
@@ -247,6 +253,7 @@ void uCluster::makeTaskReady( uBaseTaskSeq &newTasks, unsigned int n __attribute
 void uCluster::readyQueueRemove( uBaseTaskDL *node ) {
     readyIdleTaskLock.acquire();
     readyQueue->remove( node );
+    readyTasks -= 1;
     readyIdleTaskLock.release();
 } // uCluster::readyQueueRemove
 
@@ -259,6 +266,7 @@ uBaseTask &uCluster::readyQueueTryRemove() {
     readyIdleTaskLock.acquire();
     if ( ! readyQueueEmpty() ) {
 	task = &(readyQueue->drop()->task());
+	readyTasks -= 1;
     } else {
 	task = nullptr;
     } // if
@@ -306,6 +314,85 @@ void uCluster::processorRemove( uProcessor &processor ) {
 } // uCluster::processorRemove
 
 
+// Called by a processor's kernel thread when it starts on or migrates to this cluster, so its affinity is restricted
+// to the CPUs of the cluster's memory node.
+
+void uCluster::numaPin() {
+#if defined( __U_MULTI__ ) && defined( __U_AFFINITY__ )
+  if ( numaNode == -1 ) return;
+    cpu_set_t mask;
+    if ( uNUMA::cpus( numaNode, mask ) && sched_setaffinity( 0, sizeof(cpu_set_t), &mask ) != 0 ) {
+	abort( "(uCluster &)%p.numaPin() : internal error, could not set processor affinity, error(%d) %s.", this, errno, strerror( errno ) );
+    } // if
+#endif // __U_MULTI__ && __U_AFFINITY__
+} // uCluster::numaPin
+
+
+// Binding a cluster to a memory node pins its current and future processors to the CPUs of that node, and task stacks
+// and mmapped storage allocated by tasks on the cluster prefer memory from that node. Unbinding (-1) leaves the affinity
+// of existing processors unchanged.
+
+int uCluster::setNUMANode( int node ) {
+    int prev = numaNode;
+#ifdef __U_DEBUG__
+    if ( node < -1 || node >= (int)uNUMA::nodes() ) {
+	abort( "(uCluster &)%p.setNUMANode( %d ) : memory node must be -1 or in the range 0..%u.", this, node, uNUMA::nodes() - 1 );
+    } // if
+#endif // __U_DEBUG__
+    numaNode = node;
+#if defined( __U_MULTI__ ) && defined( __U_AFFINITY__ )
+    cpu_set_t mask;
+    if ( node != -1 && uNUMA::cpus( node, mask ) ) {
+	processorsOnClusterLock.acquire();
+	uProcessorDL *pr;
+	for ( uSeqIter<uProcessorDL> iter(processorsOnCluster); iter >> pr; ) {
+	    pr->processor().setAffinity( mask );
+	} // for
+	processorsOnClusterLock.release();
+    } // if
+#endif // __U_MULTI__ && __U_AFFINITY__
+    return prev;
+} // uCluster::setNUMANode
+
+
+// Admission control for real-time work: a task with worst-case execution time cost per period is admitted if the total
+// utilization of admitted work stays within the bound. With earliest-deadline-first scheduling, a bound of 1 per
+// processor guarantees deadlines on a uniprocessor and bounded tardiness on a multiprocessor.
+
+bool uCluster::admit( uDuration cost, uDuration period ) {
+#ifdef __U_DEBUG__
+    if ( cost < 0 || period <= 0 ) {
+	abort( "(uCluster &)%p.admit : cost must be non-negative and period positive.", this );
+    } // if
+#endif // __U_DEBUG__
+    double u = (double)cost.nanoseconds() / (double)period.nanoseconds();
+    admissionLock.acquire();
+    double bound = utilizationBound != 0.0 ? utilizationBound : (numProcessors != 0 ? numProcessors : 1);
+    bool admitted = utilization + u <= bound;
+    if ( admitted ) utilization += u;
+    admissionLock.release();
+    return admitted;
+} // uCluster::admit
+
+
+void uCluster::withdraw( uDuration cost, uDuration period ) {
+    double u = (double)cost.nanoseconds() / (double)period.nanoseconds();
+    admissionLock.acquire();
+    utilization -= u;
+    if ( utilization < 0.0 ) utilization = 0.0;		// rounding
+    admissionLock.release();
+} // uCluster::withdraw
+
+
+double uCluster::setUtilizationBound( double bound ) {
+    admissionLock.acquire();
+    double prev = utilizationBound;
+    utilizationBound = bound;
+    admissionLock.release();
+    return prev;
+} // uCluster::setUtilizationBound
+
+
 #if defined( __U_MULTI__ )
 void uCluster::processorPoke() {
     processorsOnClusterLock.acquire();
@@ -336,6 +423,11 @@ void uCluster::createCluster( unsigned int stackSize, const char *name ) {
 
     numProcessors = 0;
     idleProcessorsCnt = 0;
+    readyTasks = 0;
+    parks = wakes = 0;
+    numaNode = -1;
+    utilization = 0.0;
+    utilizationBound = 0.0;
 
     setName( name );
     setStackSize( stackSize );
@@ -0,0 +1,136 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// uElastic.cc --
+//
+// Author           :
+// Created On       : Sun Oct 18 18:04:31 2026
+// Last Modified By :
+// Last Modified On : Sun Oct 18 18:04:31 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+
+#define __U_KERNEL__
+#include <uC++.h>
+#include <uElastic.h>
+
+//#include <uDebug.h>
+
+
+void uElasticProcessors::grow() {
+    added[stats.added] = new uProcessor( cluster );
+    stats.added += 1;
+    stats.grows += 1;
+} // uElasticProcessors::grow
+
+
+void uElasticProcessors::shrink() {
+    stats.added -= 1;
+    delete added[stats.added];				// waits for the processor's current task to move
+    stats.shrinks += 1;
+} // uElasticProcessors::shrink
+
+
+void uElasticProcessors::sample() {
+    unsigned int processors = cluster.getProcessors();
+    unsigned int ready = cluster.getReadyTasks(), idle = cluster.getIdleProcessors();
+    unsigned long int parks = cluster.getParks(), wakes = cluster.getWakes();
+    unsigned long int parked = parks - lastParks, woken = wakes - lastWakes;
+    lastParks = parks;
+    lastWakes = wakes;
+
+    stats.samples += 1;
+    stats.parks += parked;
+    stats.wakes += woken;
+
+    if ( ready > processors && idle == 0 ) {		// more work than processors ?
+	shrinkVotes = 0;
+	growVotes += 1;
+	if ( growVotes >= growAfter && processors < max ) {
+	    grow();
+	    growVotes = 0;
+	} // if
+    } else if ( idle > 0 && ready == 0 && woken == 0 ) { // idle capacity unused ?
+	growVotes = 0;
+	shrinkVotes += 1;
+	if ( shrinkVotes >= shrinkAfter && processors > min && stats.added > 0 ) {
+	    shrink();
+	    shrinkVotes = 0;
+	} // if
+    } else {
+	growVotes = shrinkVotes = 0;
+    } // if
+
+    stats.processors = cluster.getProcessors();
+    if ( stats.processors > stats.peak ) stats.peak = stats.processors;
+} // uElasticProcessors::sample
+
+
+void uElasticProcessors::main() {
+    for ( ;; ) {
+	_Accept( ~uElasticProcessors ) {
+	    break;
+	} or _Accept( statistics, setHysteresis ) {
+	} or _Timeout( period ) {
+	    sample();
+	} // _Accept
+    } // for
+} // uElasticProcessors::main
+
+
+uElasticProcessors::uElasticProcessors( uCluster &cluster, unsigned int min, unsigned int max, uDuration period ) :
+	uBaseTask( *uKernelModule::systemCluster ), cluster( cluster ), min( min ), max( max ), period( period ) {
+    if ( min > max || max == 0 ) {
+	abort( "uElasticProcessors: invalid processor bounds, minimum %u greater than maximum %u or maximum 0.", min, max );
+    } // if
+    growAfter = 2;					// react quickly to load
+    shrinkAfter = 50;					// release slowly, 0.5 seconds at default period
+    growVotes = shrinkVotes = 0;
+    lastParks = cluster.getParks();
+    lastWakes = cluster.getWakes();
+    added = new uProcessor *[max];
+    stats = { cluster.getProcessors(), 0, cluster.getProcessors(), 0, 0, 0, 0, 0 };
+    while ( cluster.getProcessors() < min ) grow();	// start at lower bound
+    stats.grows = 0;					// initial processors are not load driven
+    stats.processors = stats.peak = cluster.getProcessors();
+} // uElasticProcessors::uElasticProcessors
+
+
+uElasticProcessors::~uElasticProcessors() {
+    while ( stats.added > 0 ) {
+	stats.added -= 1;
+	delete added[stats.added];
+    } // while
+    delete [] added;
+} // uElasticProcessors::~uElasticProcessors
+
+
+void uElasticProcessors::setHysteresis( unsigned int growAfter, unsigned int shrinkAfter ) {
+    uElasticProcessors::growAfter = growAfter == 0 ? 1 : growAfter;
+    uElasticProcessors::shrinkAfter = shrinkAfter == 0 ? 1 : shrinkAfter;
+} // uElasticProcessors::setHysteresis
+
+
+uElasticProcessors::Statistics uElasticProcessors::statistics() {
+    return stats;
+} // uElasticProcessors::statistics
+
+
+// Local Variables: //
+// compile-command: "make install" //
+// End: //
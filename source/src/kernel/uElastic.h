@@ -0,0 +1,73 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// uElastic.h -- Add and remove processors of a cluster between bounds as its load changes.
+//
+// Author           :
+// Created On       : Sun Oct 18 18:04:31 2026
+// Last Modified By :
+// Last Modified On : Sun Oct 18 18:04:31 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+
+#pragma once
+
+
+// An elastic controller samples a cluster every period from the system cluster, so an overloaded cluster does not delay
+// its own sampling. A sample votes to grow when more tasks are ready than there are processors and no processor is
+// idle, and votes to shrink when a processor is idle, no task is ready, and no paused processor was woken since the
+// last sample, i.e., the idle capacity is not being used. One processor is added after growAfter consecutive
+// grow votes and one removed after shrinkAfter consecutive shrink votes; an opposite vote resets the count. Only
+// processors created by the controller are removed, newest first, so processors created by the program are never
+// touched. Deleting the controller deletes its processors.
+
+_Task uElasticProcessors {
+  public:
+    struct Statistics {
+	unsigned int processors;			// processors on cluster at last sample
+	unsigned int added;				// processors currently owned by controller
+	unsigned int peak;				// most processors on cluster at a sample
+	unsigned long int samples, grows, shrinks;
+	unsigned long int parks, wakes;			// processor pauses and wakeups observed
+    }; // Statistics
+  private:
+    uCluster &cluster;
+    const unsigned int min, max;
+    const uDuration period;
+    unsigned int growAfter, shrinkAfter;		// hysteresis, in consecutive samples
+    unsigned int growVotes, shrinkVotes;
+    unsigned long int lastParks, lastWakes;
+    uProcessor **added;					// stack of processors created by controller
+    Statistics stats;
+
+    void grow();
+    void shrink();
+    void sample();
+    void main();
+  public:
+    uElasticProcessors( uCluster &cluster, unsigned int min, unsigned int max, uDuration period = uDuration( 0, 10000000 ) );
+    ~uElasticProcessors();
+
+    void setHysteresis( unsigned int growAfter, unsigned int shrinkAfter );
+    Statistics statistics();
+}; // uElasticProcessors
+
+
+// Local Variables: //
+// compile-command: "make install" //
+// End: //
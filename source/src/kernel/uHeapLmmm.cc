@@ -40,11 +40,18 @@
 #include <cstdio>
 #include <cstring>
 #include <new>
-#include <unistd.h>					// sbrk, sysconf
+#include <unistd.h>					// sysconf, read, close
+#include <fcntl.h>					// open
 
 #define LIKELY(x)       __builtin_expect(!!(x), 1)
 #define UNLIKELY(x)     __builtin_expect(!!(x), 0)
 
+#if defined( MADV_FREE )
+#define FREEADVICE MADV_FREE				// lazy release, pages reclaimed under memory pressure
+#else
+#define FREEADVICE MADV_DONTNEED
+#endif // MADV_FREE
+
 
 namespace UPP {
     #ifdef __U_DEBUG__
@@ -54,8 +61,10 @@ namespace UPP {
 
     uHeapManager * uHeapManager::heapManagerInstance = nullptr;
     size_t uHeapManager::pageSize;			// architecture pagesize
-    size_t uHeapManager::heapExpand;			// sbrk advance
+    size_t uHeapManager::heapExpand;			// minimum arena segment size
+    size_t uHeapManager::hugePageSize;			// transparent huge-page size, 0 => unavailable
     size_t uHeapManager::mmapStart;			// cross over point for mmap
+    size_t uHeapManager::purgeThreshold = ~(size_t)0;	// default => free blocks keep their pages
     unsigned int uHeapManager::maxBucketsUsed;		// maximum number of buckets in use
 
     // Bucket size must be multiple of 16.
@@ -96,8 +105,10 @@ namespace UPP {
     unsigned int uHeapManager::mmap_calls = 0;
     unsigned long long int uHeapManager::munmap_storage = 0;
     unsigned int uHeapManager::munmap_calls = 0;
-    unsigned long long int uHeapManager::sbrk_storage = 0;
-    unsigned int uHeapManager::sbrk_calls = 0;
+    unsigned long long int uHeapManager::arena_storage = 0;
+    unsigned int uHeapManager::arena_calls = 0;
+    unsigned long long int uHeapManager::purge_storage = 0;
+    unsigned int uHeapManager::purge_calls = 0;
     unsigned long long int uHeapManager::malloc_storage = 0;
     unsigned int uHeapManager::malloc_calls = 0;
     unsigned long long int uHeapManager::free_storage = 0;
@@ -110,12 +121,23 @@ namespace UPP {
     unsigned int uHeapManager::cmemalign_calls = 0;
     unsigned long long int uHeapManager::realloc_storage = 0;
     unsigned int uHeapManager::realloc_calls = 0;
+    unsigned long long int uHeapManager::realloc_inplace_storage = 0;
+    unsigned int uHeapManager::realloc_inplace_calls = 0;
+    unsigned long long int uHeapManager::realloc_mremap_storage = 0;
+    unsigned int uHeapManager::realloc_mremap_calls = 0;
+    unsigned long long int uHeapManager::realloc_copy_storage = 0;
+    unsigned int uHeapManager::realloc_copy_calls = 0;
     // Statistics file descriptor (changed by malloc_stats_fd).
     int uHeapManager::stats_fd = STDERR_FILENO;		// default stderr
 
+    // Committed storage is the arena segments plus the live mmapped blocks. Resident storage is the arena pages in memory
+    // plus the live mmapped blocks, which are assumed resident.
+
     // Use "write" because streams may be shutdown when calls are made.
     void uHeapManager::print() {
-	char helpText[512];
+	unsigned long long int mapped = mmap_storage - munmap_storage;
+	unsigned long long int resident = heapManagerInstance != nullptr ? heapManagerInstance->resident() : 0;
+	char helpText[1024];
 	int len = snprintf( helpText, sizeof(helpText),
 			    "\nHeap statistics:\n"
 			    "  malloc: calls %u / storage %llu\n"
@@ -123,25 +145,37 @@ namespace UPP {
 			    "  memalign: calls %u / storage %llu\n"
 			    "  cmemalign: calls %u / storage %llu\n"
 			    "  realloc: calls %u / storage %llu\n"
+			    "  realloc in place: calls %u / storage %llu\n"
+			    "  realloc mremap: calls %u / storage %llu\n"
+			    "  realloc copy: calls %u / storage %llu\n"
 			    "  free: calls %u / storage %llu\n"
 			    "  mmap: calls %u / storage %llu\n"
 			    "  munmap: calls %u / storage %llu\n"
-			    "  sbrk: calls %u / storage %llu\n",
+			    "  arena: calls %u / storage %llu\n"
+			    "  purge: calls %u / storage %llu\n"
+			    "  committed: storage %llu / resident %llu\n",
 			    malloc_calls, malloc_storage,
 			    calloc_calls, calloc_storage,
 			    memalign_calls, memalign_storage,
 			    cmemalign_calls, cmemalign_storage,
 			    realloc_calls, realloc_storage,
+			    realloc_inplace_calls, realloc_inplace_storage,
+			    realloc_mremap_calls, realloc_mremap_storage,
+			    realloc_copy_calls, realloc_copy_storage,
 			    free_calls, free_storage,
 			    mmap_calls, mmap_storage,
 			    munmap_calls, munmap_storage,
-			    sbrk_calls, sbrk_storage
+			    arena_calls, arena_storage,
+			    purge_calls, purge_storage,
+			    arena_storage + mapped, resident + mapped
 	    );
 	uDebugWrite( stats_fd, helpText, len );
     } // uHeapManager::print
 
     int uHeapManager::printXML( FILE * stream ) {
-	char helpText[512];
+	unsigned long long int mapped = mmap_storage - munmap_storage;
+	unsigned long long int resident = heapManagerInstance != nullptr ? heapManagerInstance->resident() : 0;
+	char helpText[1024];
 	int len = snprintf( helpText, sizeof(helpText),
 			    "<malloc version=\"1\">\n"
 			    "<heap nr=\"0\">\n"
@@ -152,20 +186,31 @@ namespace UPP {
 			    "<total type=\"memalign\" count=\"%u\" size=\"%llu\"/>\n"
 			    "<total type=\"cmemalign\" count=\"%u\" size=\"%llu\"/>\n"
 			    "<total type=\"realloc\" count=\"%u\" size=\"%llu\"/>\n"
+			    "<total type=\"realloc-inplace\" count=\"%u\" size=\"%llu\"/>\n"
+			    "<total type=\"realloc-mremap\" count=\"%u\" size=\"%llu\"/>\n"
+			    "<total type=\"realloc-copy\" count=\"%u\" size=\"%llu\"/>\n"
 			    "<total type=\"free\" count=\"%u\" size=\"%llu\"/>\n"
 			    "<total type=\"mmap\" count=\"%u\" size=\"%llu\"/>\n"
 			    "<total type=\"munmap\" count=\"%u\" size=\"%llu\"/>\n"
-			    "<total type=\"sbrk\" count=\"%u\" size=\"%llu\"/>\n"
+			    "<total type=\"arena\" count=\"%u\" size=\"%llu\"/>\n"
+			    "<total type=\"purge\" count=\"%u\" size=\"%llu\"/>\n"
+			    "<system type=\"committed\" size=\"%llu\"/>\n"
+			    "<system type=\"resident\" size=\"%llu\"/>\n"
 			    "</malloc>",
 			    malloc_calls, malloc_storage,
 			    calloc_calls, calloc_storage,
 			    memalign_calls, memalign_storage,
 			    cmemalign_calls, cmemalign_storage,
 			    realloc_calls, realloc_storage,
+			    realloc_inplace_calls, realloc_inplace_storage,
+			    realloc_mremap_calls, realloc_mremap_storage,
+			    realloc_copy_calls, realloc_copy_storage,
 			    free_calls, free_storage,
 			    mmap_calls, mmap_storage,
 			    munmap_calls, munmap_storage,
-			    sbrk_calls, sbrk_storage
+			    arena_calls, arena_storage,
+			    purge_calls, purge_storage,
+			    arena_storage + mapped, resident + mapped
 	    );
 	uDebugWrite( fileno( stream ), helpText, len );	// ensures all bytes written or exit
 	return len;
@@ -175,7 +220,7 @@ namespace UPP {
     inline void uHeapManager::noMemory() {
 	abort( "Heap memory exhausted at %zu bytes.\n"
 		"Possible cause is very large memory allocation and/or large amount of unfreed storage allocated by the program or system/library routines.",
-		((char *)(sbrk( 0 )) - (char *)(uHeapManager::heapManagerInstance->heapBegin)) );
+		uHeapManager::heapManagerInstance->heapStorage );
     } // uHeapManager::noMemory
 
     inline void uHeapManager::checkAlign( size_t alignment ) {
@@ -190,7 +235,7 @@ namespace UPP {
 	return false;
     } // uHeapManager::setHeapExpand
 
-    bool uHeapManager::setMmapStart( size_t value ) {	// true => mmapped, false => sbrk
+    bool uHeapManager::setMmapStart( size_t value ) {	// true => mmapped, false => arena
       if ( value < pageSize || bucketSizes[NoBucketSizes-1] < value ) return true;
 	mmapStart = value;				// set global
 
@@ -201,6 +246,12 @@ namespace UPP {
 	return false;
     } // uHeapManager::setMmapStart
 
+    bool uHeapManager::setPurgeThreshold( size_t value ) {
+      if ( value < pageSize ) return true;
+	purgeThreshold = value;
+	return false;
+    } // uHeapManager::setPurgeThreshold
+
     static inline void checkHeader( bool check, const char * name, void * addr ) {
 	if ( UNLIKELY( check ) ) {			// bad address ?
 	    abort( "Attempt to %s storage %p with address outside the heap.\n"
@@ -238,24 +289,18 @@ namespace UPP {
 
     inline bool uHeapManager::headers( const char * name __attribute__(( unused )), void * addr, Storage::Header *& header, FreeHeader *& freeElem, size_t & size, size_t & alignment ) {
 	header = headerAddr( addr );
+	fakeHeader( header, alignment );
 
-	if ( UNLIKELY( heapEnd < addr ) ) {		// mmapped ?
-	    fakeHeader( header, alignment );
-	    size = header->kind.real.blockSize & -3;	// mmap size
+	if ( UNLIKELY( header->kind.real.blockSize & 4 ) ) { // mmapped ?
+	    size = header->kind.real.blockSize & -7;	// mmap size
 	    return true;
 	} // if
 
 	#ifdef __U_DEBUG__
-	checkHeader( addr < heapBegin || header < heapBegin, name, addr ); // bad low address ?
+	checkHeader( header < heapBegin || heapEnd <= header, name, addr ); // bad address ? (offset could be + or -)
 	#endif // __U_DEBUG__
 
-	// header may be safe to dereference
-	fakeHeader( header, alignment );
-	#ifdef __U_DEBUG__
-	checkHeader( header < heapBegin || heapEnd < header, name, addr ); // bad address ? (offset could be + or -)
-	#endif // __U_DEBUG__
-
-	freeElem = (FreeHeader *)((size_t)header->kind.real.home & -3);
+	freeElem = (FreeHeader *)((size_t)header->kind.real.home & -7);
 	#ifdef __U_DEBUG__
 	if ( freeElem < &freeLists[0] || &freeLists[NoBucketSizes] <= freeElem ) {
 	    abort( "Attempt to %s storage %p with corrupted header.\n"
@@ -268,43 +313,183 @@ namespace UPP {
     } // uHeapManager::headers
 
 
+    // The arena is a list of mmapped segments rather than a contiguous sbrk region, so its storage can be released to
+    // the operating system. Once the arena has grown to a huge page it is hot, and later segments are huge-page sized,
+    // aligned and advised for transparent huge pages, so frequently reused bucket storage needs fewer TLB entries.
+    // Called with extlock acquired.
+
+    inline uHeapManager::Segment * uHeapManager::newSegment( size_t size ) {
+	size = uCeiling( size, pageSize );
+	size_t align = 0;
+	if ( hugePageSize != 0 && heapStorage + size >= hugePageSize ) { // hot arena ?
+	    size = uCeiling( size, hugePageSize );
+	    align = hugePageSize;
+	} // if
+	char * addr = (char *)::mmap( 0, size + align, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, mmapFd, 0 );
+      if ( addr == MAP_FAILED ) return nullptr;
+	if ( align != 0 ) {				// trim to alignment boundary
+	    char * start = (char *)uCeiling( (uintptr_t)addr, align );
+	    if ( start != addr ) munmap( addr, start - addr );
+	    munmap( start + size, addr + align - start );
+	    addr = start;
+	    #if defined( MADV_HUGEPAGE )
+	    madvise( addr, size, MADV_HUGEPAGE );
+	    #endif // MADV_HUGEPAGE
+	} // if
+
+	Segment * segment = (Segment *)addr;
+	segment->next = segments;
+	segment->size = size;
+	segments = segment;
+	if ( heapBegin == nullptr || addr < heapBegin ) heapBegin = addr;
+	if ( heapEnd < addr + size ) heapEnd = addr + size;
+	heapStorage += size;
+	#ifdef __U_STATISTICS__
+	arena_calls += 1;
+	arena_storage += size;
+	#endif // __U_STATISTICS__
+	return segment;
+    } // uHeapManager::newSegment
+
+
+    // Carve the unused tail of the current segment into the largest blocks that fit and put them on the free lists, so
+    // the tail is not lost when allocation moves to a new segment. Called with extlock acquired.
+
+    inline void uHeapManager::salvage() {
+	for ( ;; ) {
+	    unsigned int i = std::upper_bound( bucketSizes, bucketSizes + maxBucketsUsed + 1, heapRemaining ) - bucketSizes;
+	  if ( i == 0 ) break;				// smaller than smallest bucket ?
+	    FreeHeader * freeElem = &freeLists[i - 1];
+	    Storage * block = (Storage *)heapNext;
+	    heapNext += freeElem->blockSize;
+	    heapRemaining -= freeElem->blockSize;
+	    #if defined( SPINLOCK )
+	    freeElem->lock.acquire();
+	    block->header.kind.real.next = freeElem->freeList; // push on stack
+	    freeElem->freeList = block;
+	    freeElem->lock.release();
+	    #else
+	    freeElem->freeList.push( *block );
+	    #endif // SPINLOCK
+	} // for
+    } // uHeapManager::salvage
+
+
     inline void * uHeapManager::extend( size_t size ) {
 	extlock.acquire();
-	uDEBUGPRT( uDebugPrt( "(uHeapManager &)%p.extend( %zu ), heapBegin:%p, heapEnd:%p, heapRemaining:0x%zx, sbrk:%p\n",
-			      this, size, heapBegin, heapEnd, heapRemaining, sbrk(0) ); )
+	uDEBUGPRT( uDebugPrt( "(uHeapManager &)%p.extend( %zu ), heapBegin:%p, heapEnd:%p, heapNext:%p, heapRemaining:0x%zx\n",
+			      this, size, heapBegin, heapEnd, heapNext, heapRemaining ); )
 	ptrdiff_t rem = heapRemaining - size;
 	if ( rem < 0 ) {
-	    // If the size requested is bigger than the current remaining storage, increase the size of the heap.
+	    // If the size requested is bigger than the current remaining storage, start a new segment.
 
-	    size_t increase = uCeiling( size > heapExpand ? size : heapExpand, uAlign() );
-	    if ( sbrk( increase ) == (void *)-1 ) {
-		uDEBUGPRT( uDebugPrt( "0x%zx = (uHeapManager &)%p.extend( %zu ), heapBegin:%p, heapEnd:%p, heapRemaining:0x%zx, sbrk:%p\n",
-				      nullptr, this, size, heapBegin, heapEnd, heapRemaining, sbrk(0) ); )
+	    size_t prefix = uCeiling( sizeof(Segment), uAlign() ); // segment header
+	    Segment * segment = newSegment( prefix + (size > heapExpand ? size : heapExpand) );
+	    if ( segment == nullptr ) {
+		uDEBUGPRT( uDebugPrt( "0x%zx = (uHeapManager &)%p.extend( %zu ), heapBegin:%p, heapEnd:%p, heapNext:%p, heapRemaining:0x%zx\n",
+				      nullptr, this, size, heapBegin, heapEnd, heapNext, heapRemaining ); )
 		extlock.release();
 		errno = ENOMEM;
 		return nullptr;
 	    } // if
-	    #ifdef __U_STATISTICS__
-	    sbrk_calls += 1;
-	    sbrk_storage += increase;
-	    #endif // __U_STATISTICS__
+	    salvage();
 	    #ifdef __U_DEBUG__
 	    // Set new memory to garbage so subsequent uninitialized usages might fail.
-	    memset( (char *)heapEnd + heapRemaining, '\377', increase );
+	    memset( (char *)segment + prefix, '\377', segment->size - prefix );
 	    #endif // __U_DEBUG__
-	    rem = heapRemaining + increase - size;
+	    heapNext = (char *)segment + prefix;
+	    heapRemaining = segment->size - prefix;
+	    rem = heapRemaining - size;
 	} // if
 
-	Storage * block = (Storage *)heapEnd;
+	Storage * block = (Storage *)heapNext;
 	heapRemaining = rem;
-	heapEnd = (char *)heapEnd + size;
-	uDEBUGPRT( uDebugPrt( "%p = (uHeapManager &)%p.extend( %zu ), heapBegin:%p, heapEnd:%p, heapRemaining:0x%zx, sbrk:%p\n",
-			      block, this, size, heapBegin, heapEnd, heapRemaining, sbrk(0) ); )
+	heapNext += size;
+	uDEBUGPRT( uDebugPrt( "%p = (uHeapManager &)%p.extend( %zu ), heapBegin:%p, heapEnd:%p, heapNext:%p, heapRemaining:0x%zx\n",
+			      block, this, size, heapBegin, heapEnd, heapNext, heapRemaining ); )
 	extlock.release();
 	return block;
     } // uHeapManager::extend
 
 
+    inline uHeapManager::FreeHeader * uHeapManager::bucket( size_t tsize ) { // smallest bucket holding tsize bytes
+	FreeHeader * freeElem =
+	    #ifdef FASTLOOKUP
+	    tsize < LookupSizes ? &freeLists[lookup[tsize]] :
+	    #endif // FASTLOOKUP
+	    std::lower_bound( freeLists, freeLists + maxBucketsUsed, tsize ); // binary search
+	assert( freeElem <= &freeLists[maxBucketsUsed] ); // subscripting error ?
+	assert( tsize <= freeElem->blockSize );		// search failure ?
+	return freeElem;
+    } // uHeapManager::bucket
+
+
+    // Grow a bucket block in place when it is the last block carved from the current segment, by moving it to a larger
+    // bucket and taking the difference from the segment tail.
+
+    inline bool uHeapManager::expand( Storage::Header * header, void * addr, size_t size, size_t bsize ) {
+	size_t offset = (char *)addr - (char *)header;	// header and alignment padding
+      if ( UNLIKELY( size > ~0ul - offset ) ) return false;
+	size_t tsize = size + offset;
+      if ( tsize >= mmapStart ) return false;		// large size => mmap
+	FreeHeader * freeElem = bucket( tsize );
+	size_t delta = freeElem->blockSize - bsize;
+
+	extlock.acquire();
+	if ( (char *)header + bsize != heapNext || heapRemaining < delta ) { // not last block or tail too small ?
+	    extlock.release();
+	    return false;
+	} // if
+	heapNext += delta;
+	heapRemaining -= delta;
+	extlock.release();
+
+	bool zeroFill = (header->kind.real.blockSize & 2) != 0;
+	header->kind.real.home = freeElem;		// pointer back to larger free list
+	if ( zeroFill ) {
+	    memset( (char *)header + bsize, '\0', delta ); // zero new storage
+	    header->kind.real.blockSize |= 2;		// keep zero fill mark
+	} // if
+	#ifdef __U_DEBUG__
+	uFetchAdd( uHeapManager::allocfree, delta );
+	#endif // __U_DEBUG__
+	return true;
+    } // uHeapManager::expand
+
+
+    // Resize an mmapped block with mremap, which moves page mappings rather than copying data. The block may move, but
+    // its offset within the first page is unchanged, so alignments up to the page size are preserved.
+
+    inline void * uHeapManager::remap( Storage::Header * header, void * addr, size_t size, size_t bsize ) {
+	size_t offset = (char *)addr - (char *)header;	// header and alignment padding
+      if ( UNLIKELY( size > ~0ul - pageSize - offset ) ) return nullptr;
+	size_t tsize = uCeiling( size + offset, pageSize ); // must be multiple of page size
+      if ( tsize < mmapStart ) return nullptr;		// small size => bucket
+	Storage::Header * nheader = (Storage::Header *)::mremap( header, bsize, tsize, MREMAP_MAYMOVE );
+      if ( nheader == MAP_FAILED ) return nullptr;
+	nheader->kind.real.blockSize = tsize | (nheader->kind.real.blockSize & 6); // keep zero fill and mmapped marks
+
+	if ( tsize > bsize ) {				// grown ?
+	    uCluster * cluster = THREAD_GETMEM( activeCluster ); // null during boot
+	    if ( cluster != nullptr && cluster->getNUMANode() != -1 ) { // cluster bound to memory node ?
+		uNUMA::bind( (char *)nheader + bsize, tsize - bsize, cluster->getNUMANode() ); // before first touch
+	    } // if
+	    #ifdef __U_DEBUG__
+	    // Set new memory to garbage so subsequent uninitialized usages might fail, unless zero filled.
+	    if ( (nheader->kind.real.blockSize & 2) == 0 ) memset( (char *)nheader + bsize, '\377', tsize - bsize );
+	    #endif // __U_DEBUG__
+	} // if
+	#ifdef __U_STATISTICS__
+	if ( tsize > bsize ) uFetchAdd( mmap_storage, tsize - bsize );
+	else uFetchAdd( munmap_storage, bsize - tsize );
+	#endif // __U_STATISTICS__
+	#ifdef __U_DEBUG__
+	uFetchAdd( uHeapManager::allocfree, tsize - bsize );
+	#endif // __U_DEBUG__
+	return (char *)nheader + offset;
+    } // uHeapManager::remap
+
+
     inline void * uHeapManager::doMalloc( size_t size ) {
 	uDEBUGPRT( uDebugPrt( "(uHeapManager &)%p.doMalloc( %zu )\n", this, size ); )
 
@@ -315,14 +500,8 @@ namespace UPP {
 
       if ( UNLIKELY( size > ~0ul - sizeof(Storage) ) ) return nullptr;
 	size_t tsize = size + sizeof(Storage);
-	if ( LIKELY( tsize < mmapStart ) ) {		// small size => sbrk
-	    FreeHeader * freeElem =
-		#ifdef FASTLOOKUP
-		tsize < LookupSizes ? &freeLists[lookup[tsize]] :
-		#endif // FASTLOOKUP
-		std::lower_bound( freeLists, freeLists + maxBucketsUsed, tsize ); // binary search
-	    assert( freeElem <= &freeLists[maxBucketsUsed] ); // subscripting error ?
-	    assert( tsize <= freeElem->blockSize );	// search failure ?
+	if ( LIKELY( tsize < mmapStart ) ) {		// small size => arena
+	    FreeHeader * freeElem = bucket( tsize );
 	    tsize = freeElem->blockSize;		// total space needed for request
 
 	    uDEBUGPRT( uDebugPrt( "(uHeapManager &)%p.doMalloc, size after lookup:%zu\n", this, tsize ); )
@@ -364,11 +543,15 @@ namespace UPP {
 		// Do not call strerror( errno ) as it may call malloc.
 		abort( "(uHeapManager &)0x%p.doMalloc() : internal error, mmap failure, size:%zu error:%d.", this, tsize, errno );
 	    } // if
+	    uCluster * cluster = THREAD_GETMEM( activeCluster ); // null during boot
+	    if ( cluster != nullptr && cluster->getNUMANode() != -1 ) { // cluster bound to memory node ?
+		uNUMA::bind( block, tsize, cluster->getNUMANode() ); // before first touch
+	    } // if
 	    #ifdef __U_DEBUG__
 	    // Set new memory to garbage so subsequent uninitialized usages might fail.
 	    memset( block, '\377', tsize );
 	    #endif // __U_DEBUG__
-	    block->header.kind.real.blockSize = tsize;	// storage size for munmap
+	    block->header.kind.real.blockSize = tsize | 4; // storage size for munmap, mark as mmapped
 	} // if
 
 	void * addr = &(block->data);			// adjust off header to user bytes
@@ -431,6 +614,7 @@ namespace UPP {
 	    #ifdef __U_STATISTICS__
 	    free_storage += size;
 	    #endif // __U_STATISTICS__
+	    if ( UNLIKELY( size >= purgeThreshold ) ) purgeBlock( (Storage *)header, size, FREEADVICE ); // before block is shared
 	    #if defined( SPINLOCK )
 	    freeElem->lock.acquire();			// acquire spin lock
 	    header->kind.real.next = freeElem->freeList; // push on stack
@@ -484,10 +668,63 @@ namespace UPP {
 	uDebugPrt2( "\ntotal free blocks:%zu\n", total );
 	uDebugRelease();
 	#endif // __U_STATISTICS__
-	return (char *)heapEnd - (char *)heapBegin - total;
+	return heapStorage - heapRemaining - total;
     } // uHeapManager::prtFree
 
 
+    // Release the whole pages of a free block, except the page holding its header, which keeps the free-list link.
+
+    inline size_t uHeapManager::purgeBlock( Storage * block, size_t size, int advice ) {
+	uintptr_t start = uCeiling( (uintptr_t)block + sizeof(Storage), pageSize ), end = ((uintptr_t)block + size) & ~(pageSize - 1);
+      if ( start >= end ) return 0;
+      if ( madvise( (void *)start, end - start, advice ) == -1 ) return 0;
+	#ifdef __U_STATISTICS__
+	uFetchAdd( purge_calls, 1 );
+	uFetchAdd( purge_storage, end - start );
+	#endif // __U_STATISTICS__
+	return end - start;
+    } // uHeapManager::purgeBlock
+
+
+    // Release the free pages in all buckets, returning the number of bytes released. Lock-free buckets cannot be
+    // traversed safely, so they are not purged.
+
+    size_t uHeapManager::purge() {
+	size_t total = 0;
+	#if defined( SPINLOCK )
+	for ( unsigned int i = 0; i <= maxBucketsUsed; i += 1 ) {
+	    FreeHeader & freeElem = freeLists[i];
+	  if ( freeElem.blockSize < sizeof(Storage) + pageSize ) continue; // block cannot contain a free page ?
+	    freeElem.lock.acquire();
+	    for ( Storage * p = freeElem.freeList; p != nullptr; p = p->header.kind.real.next ) {
+		total += purgeBlock( p, freeElem.blockSize, MADV_DONTNEED );
+	    } // for
+	    freeElem.lock.release();
+	} // for
+	#endif // SPINLOCK
+	return total;
+    } // uHeapManager::purge
+
+
+    // Count the arena pages in memory. Pages released with MADV_FREE stay resident until the kernel reclaims them.
+
+    size_t uHeapManager::resident() {
+	enum { Pages = 4096 };
+	unsigned char vec[Pages];
+	size_t total = 0;
+	extlock.acquire();
+	for ( Segment * segment = segments; segment != nullptr; segment = segment->next ) {
+	    for ( size_t offset = 0; offset < segment->size; offset += Pages * pageSize ) {
+		size_t len = std::min( segment->size - offset, Pages * pageSize );
+	      if ( mincore( (char *)segment + offset, len, vec ) == -1 ) break;
+		for ( size_t p = 0; p < len / pageSize; p += 1 ) total += vec[p] & 1;
+	    } // for
+	} // for
+	extlock.release();
+	return total * pageSize;
+    } // uHeapManager::resident
+
+
     uHeapManager::uHeapManager() {
 	uDEBUGPRT( uDebugPrt( "(uHeapManager &)%p.uHeap()\n", this ); )
 	pageSize = sysconf( _SC_PAGESIZE );
@@ -509,9 +746,20 @@ namespace UPP {
 	} // if
 	heapExpand = uDefaultHeapExpansion();
 
-	char * end = (char *)sbrk( 0 );
-	sbrk( (char *)uCeiling( (long unsigned int)end, uAlign() ) - end ); // move start of heap to multiple of alignment
-	heapBegin = heapEnd = sbrk( 0 );		// get new start point
+	// Read with read rather than stdio because the heap is not yet available.
+	hugePageSize = 0;
+	int fd = ::open( "/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", O_RDONLY );
+	if ( fd != -1 ) {
+	    char buf[32];
+	    ssize_t len = ::read( fd, buf, sizeof(buf) );
+	    ::close( fd );
+	    for ( ssize_t i = 0; i < len && '0' <= buf[i] && buf[i] <= '9'; i += 1 ) hugePageSize = hugePageSize * 10 + buf[i] - '0';
+	} // if
+	if ( hugePageSize <= pageSize || ! uPow2( hugePageSize ) ) hugePageSize = 0; // unusable ?
+
+	segments = nullptr;
+	heapBegin = heapEnd = heapNext = nullptr;
+	heapRemaining = heapStorage = 0;
 
 	uDEBUGPRT( uDebugPrt( "(uHeapManager &)%p.uHeap() heapBegin:%p, heapEnd:%p\n", this, heapBegin, heapEnd ); )
     } // uHeapManager::uHeapManager
@@ -613,7 +861,7 @@ namespace UPP {
 	#ifdef __U_PROFILER__
 	if ( uThisTask().profileActive && uProfiler::uProfiler_registerMemoryAllocate ) {
 	    UPP::uHeapManager::Storage::Header * header = headerAddr( addr );
-	    PROFILEMALLOCENTRY( header ) = (* uProfiler::uProfiler_registerMemoryAllocate)( uProfiler::profilerInstance, addr, size, header->kind.real.blockSize & -3 );
+	    PROFILEMALLOCENTRY( header ) = (* uProfiler::uProfiler_registerMemoryAllocate)( uProfiler::profilerInstance, addr, size, header->kind.real.blockSize & -7 );
 	} // if
 	#endif // __U_PROFILER__
 	return addr;
@@ -746,7 +994,7 @@ extern "C" {
 	UPP::uHeapManager::Storage::Header * header;
 	UPP::uHeapManager::FreeHeader * freeElem;
 	size_t bsize, oalign = 0;
-	UPP::uHeapManager::heapManagerInstance->headers( "realloc", oaddr, header, freeElem, bsize, oalign );
+	bool mapped = UPP::uHeapManager::heapManagerInstance->headers( "realloc", oaddr, header, freeElem, bsize, oalign );
 
 	size_t odsize = dataStorage( bsize, oaddr, header ); // data storage available in bucket
       if ( size <= odsize && odsize <= size * 2 ) {	// allow up to 50% wasted storage in smaller size
@@ -762,6 +1010,28 @@ extern "C" {
 	uFetchAdd( UPP::uHeapManager::realloc_storage, size );
 	#endif // __U_STATISTICS__
 
+	// change size without copying, when possible; the header moves with the storage so the profiler entry is kept
+
+	if ( mapped ) {
+	    if ( oalign <= UPP::uHeapManager::pageSize ) { // mremap preserves alignment ?
+		void * naddr = UPP::uHeapManager::heapManagerInstance->remap( header, oaddr, size, bsize );
+		if ( naddr != nullptr ) {
+		    #ifdef __U_STATISTICS__
+		    uFetchAdd( UPP::uHeapManager::realloc_mremap_calls, 1 );
+		    uFetchAdd( UPP::uHeapManager::realloc_mremap_storage, size );
+		    #endif // __U_STATISTICS__
+		    uDEBUGPRT( uDebugPrt( "%p = realloc( %p, %zu )\n", naddr, oaddr, size ); )
+		    return naddr;
+		} // if
+	    } // if
+	} else if ( size > odsize && UPP::uHeapManager::heapManagerInstance->expand( header, oaddr, size, bsize ) ) {
+	    #ifdef __U_STATISTICS__
+	    uFetchAdd( UPP::uHeapManager::realloc_inplace_calls, 1 );
+	    uFetchAdd( UPP::uHeapManager::realloc_inplace_storage, size );
+	    #endif // __U_STATISTICS__
+	    return oaddr;
+	} // if
+
 	// change size and copy old content to new storage
 
 	void * naddr;
@@ -783,6 +1053,10 @@ extern "C" {
 	size_t ndsize = dataStorage( bsize, naddr, header ); // data storage avilable in bucket
 	// To preserve prior fill, the entire bucket must be copied versus the size.
 	memcpy( naddr, oaddr, std::min( odsize, ndsize ) ); // copy bytes
+	#ifdef __U_STATISTICS__
+	uFetchAdd( UPP::uHeapManager::realloc_copy_calls, 1 );
+	uFetchAdd( UPP::uHeapManager::realloc_copy_storage, std::min( odsize, ndsize ) );
+	#endif // __U_STATISTICS__
 	free( oaddr );
 	uDEBUGPRT( uDebugPrt( "%p = realloc( %p, %zu )\n", naddr, oaddr, size ); )
 	return naddr;
@@ -919,13 +1193,17 @@ extern "C" {
 	  case M_MMAP_THRESHOLD:
 	    if ( UPP::uHeapManager::heapManagerInstance->setMmapStart( value ) ) return 1;
 	    break;
+	  case M_TRIM_THRESHOLD:
+	    if ( UPP::uHeapManager::heapManagerInstance->setPurgeThreshold( value ) ) return 1;
+	    break;
 	} // switch
 	return 0;
     } // mallopt
 
 
-    int malloc_trim( size_t ) {
-	return 0;					// => impossible to release memory
+    int malloc_trim( size_t ) __THROW {			// segments are not unmapped, so no padding is kept
+      if ( UNLIKELY( UPP::uHeapManager::heapManagerInstance == nullptr ) ) return 0;
+	return UPP::uHeapManager::heapManagerInstance->purge() != 0; // 1 => memory released
     } // malloc_trim
 
 
@@ -993,6 +1271,10 @@ void * realloc( void * oaddr, size_t nalign, size_t size ) __THROW {
     size_t ndsize = dataStorage( bsize, naddr, header ); // data storage avilable in bucket
     // To preserve prior fill, the entire bucket must be copied versus the size.
     memcpy( naddr, oaddr, std::min( odsize, ndsize ) ); // copy bytes
+    #ifdef __U_STATISTICS__
+    uFetchAdd( UPP::uHeapManager::realloc_copy_calls, 1 );
+    uFetchAdd( UPP::uHeapManager::realloc_copy_storage, std::min( odsize, ndsize ) );
+    #endif // __U_STATISTICS__
     free( oaddr );
     uDEBUGPRT( uDebugPrt( "%p = realloc( %p, %zu )\n", naddr, oaddr, size ); )
     return naddr;
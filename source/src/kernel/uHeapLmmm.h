@@ -51,6 +51,7 @@ extern "C" {
     void malloc_stats() __THROW;
     int malloc_stats_fd( int fd ) __THROW;
     int mallopt( int param_number, int value ) __THROW;
+    int malloc_trim( size_t pad ) __THROW;
 } // extern "C"
 
 
@@ -67,7 +68,8 @@ namespace UPP {
 	friend void * ::realloc( void * addr, size_t alignment, size_t size ) __THROW; // boot
 	friend void * ::valloc( size_t size ) __THROW;	// pageSize
 	friend void ::free( void * addr ) __THROW;	// doFree
-	friend int ::mallopt( int param_number, int value ) __THROW; // heapManagerInstance, setHeapExpand, setMmapStart
+	friend int ::mallopt( int param_number, int value ) __THROW; // heapManagerInstance, setHeapExpand, setMmapStart, setPurgeThreshold
+	friend int ::malloc_trim( size_t pad ) __THROW;	// purge
 	friend bool ::malloc_zero_fill( void * addr ) __THROW; // Storage
 	// paraenthesis required for typedef
 	friend size_t (::malloc_alignment)( void * addr ) __THROW; // Header, FreeHeader
@@ -130,6 +132,11 @@ namespace UPP {
 
 	static_assert( uAlign() >= sizeof( Storage ), "uAlign() < sizeof( Storage )" );
 
+	struct Segment {				// arena segment, at the start of each mmapped arena region
+	    Segment * next;				// previous segment
+	    size_t size;				// mapped size including this header
+	}; // Segment
+
 	struct FreeHeader {
 	    #if BUCKLOCK == SPINLOCK
 	    uSpinLock lock;				// must be first field for alignment
@@ -154,8 +161,10 @@ namespace UPP {
 	static unsigned int bucketSizes[];		// different bucket sizes
 	static uHeapManager * heapManagerInstance;	// pointer to heap manager object
 	static size_t pageSize;				// architecture pagesize
-	static size_t heapExpand;			// sbrk advance
+	static size_t heapExpand;			// minimum arena segment size
+	static size_t hugePageSize;			// transparent huge-page size, 0 => unavailable
 	static size_t mmapStart;			// cross over point for mmap
+	static size_t purgeThreshold;			// free blocks at least this size release their pages
 	static unsigned int maxBucketsUsed;		// maximum number of buckets in use
 	#ifdef FASTLOOKUP
 	static unsigned char lookup[LookupSizes];	// O(1) lookup for small sizes
@@ -171,8 +180,10 @@ namespace UPP {
 	static unsigned int mmap_calls;
 	static unsigned long long int munmap_storage;
 	static unsigned int munmap_calls;
-	static unsigned long long int sbrk_storage;
-	static unsigned int sbrk_calls;
+	static unsigned long long int arena_storage;
+	static unsigned int arena_calls;
+	static unsigned long long int purge_storage;
+	static unsigned int purge_calls;
 	static unsigned long long int malloc_storage;
 	static unsigned int malloc_calls;
 	static unsigned long long int free_storage;
@@ -185,6 +196,12 @@ namespace UPP {
 	static unsigned int cmemalign_calls;
 	static unsigned long long int realloc_storage;
 	static unsigned int realloc_calls;
+	static unsigned long long int realloc_inplace_storage;
+	static unsigned int realloc_inplace_calls;
+	static unsigned long long int realloc_mremap_storage;
+	static unsigned int realloc_mremap_calls;
+	static unsigned long long int realloc_copy_storage;
+	static unsigned int realloc_copy_calls;
 	static int stats_fd;
 	static void print();
 	static int printXML( FILE * stream );
@@ -196,9 +213,12 @@ namespace UPP {
 	uSpinLock extlock;				// protects allocation-buffer extension
 	FreeHeader freeLists[NoBucketSizes];		// buckets for different allocation sizes
 
-	void * heapBegin;				// start of heap
-	void * heapEnd;					// logical end of heap
-	size_t heapRemaining;				// amount of storage not allocated in the current chunk
+	Segment * segments;				// arena segments, most recent first
+	void * heapBegin;				// lowest arena address
+	void * heapEnd;					// highest arena address
+	char * heapNext;				// next unallocated byte in the current segment
+	size_t heapRemaining;				// amount of storage not allocated in the current segment
+	size_t heapStorage;				// storage mapped for all segments
 
 	static void boot();
 	static void noMemory();				// called by "builtin_new" when malloc returns 0
@@ -206,9 +226,18 @@ namespace UPP {
 	static void checkAlign( size_t alignment );
 	static bool setHeapExpand( size_t value );
 	static bool setMmapStart( size_t value );
+	static bool setPurgeThreshold( size_t value );
+	static size_t purgeBlock( Storage * block, size_t size, int advice );
 
 	bool headers( const char * name, void * addr, Storage::Header *& header, FreeHeader *& freeElem, size_t & size, size_t & alignment );
+	Segment * newSegment( size_t size );
+	void salvage();
 	void * extend( size_t size );
+	FreeHeader * bucket( size_t tsize );
+	bool expand( Storage::Header * header, void * addr, size_t size, size_t bsize );
+	void * remap( Storage::Header * header, void * addr, size_t size, size_t bsize );
+	size_t purge();
+	size_t resident();
 	void * doMalloc( size_t size );
 	static void * mallocNoStats( size_t size ) __THROW;
 	static void * callocNoStats( size_t noOfElems, size_t elemSize ) __THROW;
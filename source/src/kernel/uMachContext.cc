@@ -107,6 +107,7 @@ namespace UPP {
 #endif
 
 	errno = 0;					// reset errno for each task
+	This.execStart = uBaseTask::cpuClock();		// start first time slice
 	This.currCoroutine->setState( uBaseCoroutine::Active ); // set state of next coroutine to active
 	This.setState( uBaseTask::Running );
 
@@ -274,15 +275,20 @@ namespace UPP {
 
 	if ( storage == nullptr ) {
 	    size = uCeiling( storageSize, 16 );
-	    // use malloc/memalign because "new" raises an exception for out-of-memory
+	    void *block = uTaskPool::get( uTaskPool::Stacks, stackOffset() + size + cxtSize );
+	    if ( block != nullptr ) {			// reuse stack, guard page still protected
+		storage = (char *)block - stackOffset();
+	    } else {
+		// use malloc/memalign because "new" raises an exception for out-of-memory
 #ifdef __U_DEBUG__
-	    storage = memalign( pageSize, cxtSize + size + pageSize );
-	    if ( ::mprotect( storage, pageSize, PROT_NONE ) == -1 ) {
-		abort( "(uMachContext &)%p.createContext() : internal error, mprotect failure, error(%d) %s.", this, errno, strerror( errno ) );
-	    } // if
+		storage = memalign( pageSize, cxtSize + size + pageSize );
+		if ( storage != nullptr && ::mprotect( storage, pageSize, PROT_NONE ) == -1 ) {
+		    abort( "(uMachContext &)%p.createContext() : internal error, mprotect failure, error(%d) %s.", this, errno, strerror( errno ) );
+		} // if
 #else
-	    storage = malloc( cxtSize + size );		// assume malloc has 16 byte alignment
+		storage = malloc( cxtSize + size );	// assume malloc has 16 byte alignment
 #endif // __U_DEBUG__
+	    } // if
 	    if ( storage == nullptr ) {
 		abort( "Attempt to allocate %zd bytes of storage for coroutine or task execution-state but insufficient memory available.", size );
 	    } // if
@@ -318,6 +324,103 @@ namespace UPP {
     } // uMachContext::createContext
 
 
+    uMachContext::~uMachContext() {
+	if ( ! ((uintptr_t)storage & 1) ) {		// check user stack storage mark
+	    size_t cxtSize = uCeiling( sizeof(uContext_t), 8 );
+	    if ( ! uTaskPool::put( uTaskPool::Stacks, (char *)storage + stackOffset(), (char *)base + cxtSize - (char *)storage ) ) {
+		freeStorage( storage );
+	    } // if
+	} // if
+    } // uMachContext::~uMachContext
+
+
+    size_t uMachContext::stackOffset() {
+#ifdef __U_DEBUG__
+	return pageSize;				// block header after guard page
+#else
+	return 0;
+#endif // __U_DEBUG__
+    } // uMachContext::stackOffset
+
+
+    void uMachContext::freeStorage( void *storage ) {
+	uDEBUG(
+	    if ( ::mprotect( storage, pageSize, PROT_READ | PROT_WRITE ) == -1 ) {
+		abort( "(uMachContext &)%p.freeStorage() : internal error, mprotect failure, error(%d) %s.", storage, errno, strerror( errno ) );
+	    } // if
+	)
+	free( storage );
+    } // uMachContext::freeStorage
+
+
+    //######################### uTaskPool #########################
+
+
+    const unsigned int uTaskPool::Limits[Kinds] = { 8, 32 }; // stacks, task objects
+
+    uTaskPool::uTaskPool() {
+	for ( unsigned int kind = 0; kind < Kinds; kind += 1 ) {
+	    top[kind] = nullptr;
+	    count[kind] = 0;
+	} // for
+	open = true;
+    } // uTaskPool::uTaskPool
+
+
+    void *uTaskPool::get( unsigned int kind, size_t size ) {
+      if ( THREAD_GETMEM( activeProcessor ) == nullptr ) return nullptr;	// kernel not started
+	Block *block = nullptr;
+	THREAD_GETMEM( This )->disableInterrupts();
+	uTaskPool &pool = THREAD_GETMEM( activeProcessor )->pool; // cannot migrate, interrupts disabled
+	for ( Block **prev = &pool.top[kind]; *prev != nullptr; prev = &(*prev)->next ) {
+	    if ( (*prev)->size == size ) {		// identical size ?
+		block = *prev;
+		*prev = block->next;
+		pool.count[kind] -= 1;
+		break;
+	    } // if
+	} // for
+	THREAD_GETMEM( This )->enableInterrupts();
+	return block;
+    } // uTaskPool::get
+
+
+    bool uTaskPool::put( unsigned int kind, void *block, size_t size ) {
+      if ( THREAD_GETMEM( activeProcessor ) == nullptr ) return false;		// kernel not started
+	bool cached = false;
+	THREAD_GETMEM( This )->disableInterrupts();
+	uTaskPool &pool = THREAD_GETMEM( activeProcessor )->pool; // cannot migrate, interrupts disabled
+	if ( pool.open && pool.count[kind] < Limits[kind] ) {
+	    Block *b = (Block *)block;
+	    b->size = size;
+	    b->next = pool.top[kind];
+	    pool.top[kind] = b;
+	    pool.count[kind] += 1;
+	    cached = true;
+	} // if
+	THREAD_GETMEM( This )->enableInterrupts();
+	return cached;
+    } // uTaskPool::put
+
+
+    void uTaskPool::close() {				// processor no longer executes tasks
+	open = false;
+	for ( unsigned int kind = 0; kind < Kinds; kind += 1 ) {
+	    for ( ;; ) {
+		Block *block = top[kind];
+	      if ( block == nullptr ) break;
+		top[kind] = block->next;
+		if ( kind == Stacks ) uMachContext::freeStorage( (char *)block - uMachContext::stackOffset() );
+		else ::operator delete( block );
+	    } // for
+	    count[kind] = 0;
+	} // for
+    } // uTaskPool::close
+
+
+    //######################### uMachContext (cont) #########################
+
+
     void *uMachContext::stackPointer() const {
 	if ( &uThisCoroutine() == this ) {		// accessing myself ?
 	    void *sp;					// use my current stack value
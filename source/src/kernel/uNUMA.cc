@@ -0,0 +1,152 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// uNUMA.cc --
+//
+// Author           :
+// Created On       : Sun Oct 18 11:02:37 2026
+// Last Modified By :
+// Last Modified On : Sun Oct 18 11:02:37 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+
+#define __U_KERNEL__
+#include <uC++.h>
+//#include <uDebug.h>
+
+#include <cstdio>					// snprintf
+#include <fcntl.h>					// open
+#include <unistd.h>					// read, close, syscall
+#include <sys/syscall.h>				// SYS_mbind, SYS_getcpu
+
+
+// The topology files are read with read rather than stdio because the routines may be called during heap and task
+// creation, where allocation is unsafe.
+
+namespace {
+    enum { MaxNodes = 1024, BufferSize = 4096 };
+    enum { MPOL_PREFERRED_ = 1, MPOL_MF_MOVE_ = 1 << 1 }; // numaif.h may be unavailable
+
+    int readFile( const char *path, char *buf, size_t size ) {
+	int fd = ::open( path, O_RDONLY );
+      if ( fd == -1 ) return -1;
+	ssize_t len = ::read( fd, buf, size - 1 );
+	::close( fd );
+      if ( len < 0 ) return -1;
+	buf[len] = '\0';
+	return len;
+    } // readFile
+
+    // Parse the next range of a list, e.g., "0-3,8,10-11\n".
+    bool nextRange( const char *&p, unsigned int &lo, unsigned int &hi ) {
+	while ( *p == ',' ) p += 1;
+      if ( *p < '0' || '9' < *p ) return false;
+	for ( lo = 0; '0' <= *p && *p <= '9'; p += 1 ) lo = lo * 10 + *p - '0';
+	hi = lo;
+	if ( *p == '-' ) {
+	    p += 1;
+	    for ( hi = 0; '0' <= *p && *p <= '9'; p += 1 ) hi = hi * 10 + *p - '0';
+	} // if
+	return true;
+    } // nextRange
+} // namespace
+
+
+//######################### uNUMA #########################
+
+
+unsigned int uNUMA::nodes() {
+    char buf[BufferSize];
+  if ( readFile( "/sys/devices/system/node/online", buf, sizeof(buf) ) <= 0 ) return 1; // no NUMA support
+    unsigned int lo, hi, max = 0;
+    for ( const char *p = buf; nextRange( p, lo, hi ); ) {
+	if ( hi > max ) max = hi;
+    } // for
+    return max + 1;
+} // uNUMA::nodes
+
+
+int uNUMA::nodeOf( unsigned int cpu ) {
+    char path[64], buf[BufferSize];
+    unsigned int n = nodes();
+    for ( unsigned int node = 0; node < n; node += 1 ) {
+	snprintf( path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", node );
+      if ( readFile( path, buf, sizeof(buf) ) <= 0 ) continue;
+	unsigned int lo, hi;
+	for ( const char *p = buf; nextRange( p, lo, hi ); ) {
+	    if ( lo <= cpu && cpu <= hi ) return node;
+	} // for
+    } // for
+    return n == 1 && cpu < (unsigned int)sysconf( _SC_NPROCESSORS_CONF ) ? 0 : -1;
+} // uNUMA::nodeOf
+
+
+int uNUMA::currentNode() {
+#if defined( SYS_getcpu )
+    unsigned int cpu, node;
+  if ( syscall( SYS_getcpu, &cpu, &node, nullptr ) == 0 ) return node;
+#endif // SYS_getcpu
+    return 0;
+} // uNUMA::currentNode
+
+
+#if defined( __U_AFFINITY__ )
+bool uNUMA::cpus( unsigned int node, cpu_set_t &mask ) {
+    char path[64], buf[BufferSize];
+    CPU_ZERO( &mask );
+    snprintf( path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", node );
+    if ( readFile( path, buf, sizeof(buf) ) <= 0 ) {	// no NUMA support => node 0 has all CPUs
+      if ( node != 0 ) return false;
+	for ( unsigned int cpu = 0; cpu < (unsigned int)sysconf( _SC_NPROCESSORS_CONF ) && cpu < CPU_SETSIZE; cpu += 1 ) {
+	    CPU_SET( cpu, &mask );
+	} // for
+	return true;
+    } // if
+    unsigned int lo, hi;
+    for ( const char *p = buf; nextRange( p, lo, hi ); ) {
+	for ( unsigned int cpu = lo; cpu <= hi && cpu < CPU_SETSIZE; cpu += 1 ) {
+	    CPU_SET( cpu, &mask );
+	} // for
+    } // for
+    return CPU_COUNT( &mask ) != 0;
+} // uNUMA::cpus
+#endif // __U_AFFINITY__
+
+
+// Only whole pages inside the range are bound, so pages shared with adjacent storage keep their placement. Pages
+// already touched are migrated.
+
+int uNUMA::bind( void *addr, size_t len, unsigned int node ) {
+#if defined( SYS_mbind )
+  if ( node >= MaxNodes ) { errno = EINVAL; return -1; }
+    size_t pageSize = sysconf( _SC_PAGESIZE );
+    uintptr_t start = uCeiling( (uintptr_t)addr, pageSize ), end = ((uintptr_t)addr + len) & ~(pageSize - 1);
+  if ( start >= end ) return 0;
+    unsigned long nodemask[MaxNodes / (8 * sizeof(unsigned long))] = { 0 };
+    nodemask[node / (8 * sizeof(unsigned long))] = 1ul << (node % (8 * sizeof(unsigned long)));
+    return syscall( SYS_mbind, start, end - start, MPOL_PREFERRED_, nodemask, MaxNodes + 1, MPOL_MF_MOVE_ );
+#else
+    errno = ENOSYS;
+    return -1;
+#endif // SYS_mbind
+} // uNUMA::bind
+
+
+// Local Variables: //
+// compile-command: "make install" //
+// End: //
@@ -51,6 +51,7 @@ using namespace UPP;
 
 
 uEventList *uProcessor::events = nullptr;
+unsigned int uProcessor::nextId = 0;
 
 #if ! defined( __U_MULTI__ )
 uEventNode *uProcessor::contextEvent = nullptr;
@@ -139,6 +140,7 @@ void uProcessorTask::main() {
 	    processor.currCluster = cluster;
 	    THREAD_SETMEM( activeCluster, cluster );
 	    cluster->processorAdd( processor );
+	    cluster->numaPin();
 	    currCluster = cluster;			// change task's notion of which cluster it is executing on
 
 #if __U_LOCALDEBUGGER_H__
@@ -226,6 +228,7 @@ void * uKernelModule::startThread( void * p __attribute__(( unused )) ) {
     THREAD_SETMEM( activeProcessor, &processor );
     uCluster *currCluster = THREAD_GETMEM( activeProcessor )->currCluster;
     THREAD_SETMEM( activeCluster, currCluster );
+    currCluster->numaPin();				// restrict to CPUs of cluster's memory node
     
     assert( THREAD_GETMEM( disableInt ) && THREAD_GETMEM( disableIntCnt ) == 1 );
 
@@ -786,6 +789,8 @@ void uProcessor::createProcessor( uCluster &cluster, bool detached, int ms, int
 
     uKernelModule::globalProcessorLock->acquire();	// add processor to global processor list.
     uKernelModule::globalProcessors->addTail( &(globalRef) );
+    id = nextId;					// dense number in creation order
+    nextId += 1;
     uKernelModule::globalProcessorLock->release();
 
     procTask = new uProcessorTask( cluster, *this );
@@ -880,6 +885,8 @@ uProcessor::~uProcessor() {
     uKernelModule::globalProcessorLock->release();
 
     currCluster->processorRemove( *this );
+    reap.close();					// deletion frees into the pool of the deleting task's processor
+    pool.close();
 #ifdef __U_MULTI__
     delete contextEvent;
     delete contextSwitchHandler;
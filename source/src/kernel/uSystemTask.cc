@@ -41,10 +41,12 @@ void uSystemTask::main() {
     for ( ;; ) {
 	_Accept( ~uSystemTask ) {
 	    break;
-	} or _Accept( reaper ) {
+	} or _Accept( reap ) {
 	    delete victim;
 	} or _Accept( pthreadDetachEnd ) {
 	    delete victim;
+	} or _Timeout( uDuration( UPP::uReapList::MaxAge ) ) {
+	    UPP::uReapList::sweep();			// finished tasks on quiet processors
 // #if __U_LOCALDEBUGGER_H__
 // 	} or _Timeout( uDuration( 1 ) ) {		// 1 second
 // #endif // __U_LOCALDEBUGGER_H__
@@ -73,11 +75,102 @@ uSystemTask::~uSystemTask() {
 } // uSystemTask::~uSystemTask
 
 
-void uSystemTask::reaper( uBaseTask &victim ) {
+void uSystemTask::reap( uBaseTask &victim ) {
     uSystemTask::victim = &victim;
+} // uSystemTask::reap
+
+
+void uSystemTask::reaper( uBaseTask &victim ) {
+    // A task reaping itself is finishing on this processor, so it is deleted with the processor's next batch. Any other
+    // task may be on another cluster and is deleted by the system task.
+    if ( &victim == &uThisTask() && UPP::uReapList::defer( victim ) ) return;
+    reap( victim );
 } // uSystemTask::reaper
 
 
+//######################### uReapList #########################
+
+
+namespace UPP {
+    uReapList::uReapList() {
+	top = nullptr;
+	count = 0;
+	open = true;
+    } // uReapList::uReapList
+
+
+    bool uReapList::defer( uBaseTask &victim ) {
+      if ( THREAD_GETMEM( activeProcessor ) == nullptr ) return false;	// kernel not started
+	uBaseTask *batch = nullptr;
+	bool deferred = false;
+	THREAD_GETMEM( This )->disableInterrupts();
+	uReapList &list = THREAD_GETMEM( activeProcessor )->reap; // cannot migrate, interrupts disabled
+	list.lock.acquire();
+	if ( list.open ) {
+	    if ( list.count >= Batch ) {		// take full list, victim starts next batch
+		batch = list.top;
+		list.top = nullptr;
+		list.count = 0;
+	    } // if
+	    if ( list.count == 0 ) list.since = uClock::currTime();
+	    victim.reapNext = list.top;
+	    list.top = &victim;
+	    list.count += 1;
+	    deferred = true;
+	} // if
+	list.lock.release();
+	THREAD_GETMEM( This )->enableInterrupts();
+	reap( batch );					// outside critical section, deletion may block
+	return deferred;
+    } // uReapList::defer
+
+
+    void uReapList::reap( uBaseTask *list ) {
+	// Tasks on a list have finished their main routines, so deletion waits at most for a task to switch away for the
+	// last time.
+	while ( list != nullptr ) {
+	    uBaseTask *victim = list;
+	    list = victim->reapNext;
+	    delete victim;
+	} // while
+    } // uReapList::reap
+
+
+    void uReapList::sweep() {
+	uTime old = uClock::currTime() - uDuration( MaxAge );
+	uBaseTask *batch = nullptr;
+	uKernelModule::globalProcessorLock->acquire();
+	uProcessorDL *pr;
+	for ( uSeqIter<uProcessorDL> iter( *uKernelModule::globalProcessors ); iter >> pr; ) {
+	    uReapList &list = pr->processor().reap;
+	    list.lock.acquire();
+	    if ( list.count != 0 && list.since <= old ) { // append list to batch
+		uBaseTask *last;
+		for ( last = list.top; last->reapNext != nullptr; last = last->reapNext );
+		last->reapNext = batch;
+		batch = list.top;
+		list.top = nullptr;
+		list.count = 0;
+	    } // if
+	    list.lock.release();
+	} // for
+	uKernelModule::globalProcessorLock->release();
+	reap( batch );					// outside critical section, deletion may block
+    } // uReapList::sweep
+
+
+    void uReapList::close() {				// processor no longer executes tasks
+	lock.acquire();
+	open = false;
+	uBaseTask *list = top;
+	top = nullptr;
+	count = 0;
+	lock.release();
+	reap( list );
+    } // uReapList::close
+} // UPP
+
+
 // Local Variables: //
 // compile-command: "make install" //
 // End: //
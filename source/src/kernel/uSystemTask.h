@@ -37,11 +37,12 @@ _Task uSystemTask {
 
     _Mutex void pthreadDetachEnd( uBaseTask &victim );
 
+    _Mutex void reap( uBaseTask &victim );
     void main();
   public:
     uSystemTask();
     ~uSystemTask();
-    void reaper( uBaseTask &victim );
+    _Nomutex void reaper( uBaseTask &victim );
 }; // uSystemTask
 
 
@@ -38,6 +38,7 @@
 #include <pthread.h>
 #include <limits.h>					// access: PTHREAD_KEYS_MAX
 #include <uStack.h>
+#include <uAdaptiveLock.h>
 
 //#include <uDebug.h>
 
@@ -261,8 +262,8 @@ namespace UPP {
 	_Nomutex void finishUp() {
 	    int detachstate;
 	    pthread_attr_getdetachstate( &pthread_attr, &detachstate );
-	    if ( detachstate == PTHREAD_CREATE_DETACHED ) {
-		uKernelModule::systemTask->pthreadDetachEnd( *this );
+	    if ( detachstate == PTHREAD_CREATE_DETACHED && ! UPP::uReapList::defer( *this ) ) {
+		uKernelModule::systemTask->pthreadDetachEnd( *this ); // processor closing
 	    } // if
 	} // uPthread::finishUp
 
@@ -1018,6 +1019,9 @@ extern "C" {
 
     //######################### Mutex #########################
 
+    // Mutexes are uAdaptiveOwnerLocks, which spin for a per-mutex tuned budget before blocking and are still owner locks
+    // for the condition-variable routines.
+
     static inline void mutex_check( pthread_mutex_t *mutex ) {
 	// Cannot use a pthread_mutex_lock due to recursion on initialization.
 	static char magic_check[sizeof(uOwnerLock)] __attribute__(( aligned (16) )); // set to zero
@@ -1038,12 +1042,12 @@ extern "C" {
 
     int pthread_mutex_init( pthread_mutex_t *mutex, const pthread_mutexattr_t * /* attr */ ) __THROW {
 	uDEBUGPRT( uDebugPrt( "pthread_mutex_init(mutex:%p, attr:%p) enter task:%p\n", mutex, attr, &uThisTask() ); )
-	PthreadLock::init< uOwnerLock >( mutex );
+	PthreadLock::init< uAdaptiveOwnerLock >( mutex );
 	return 0;
     } // pthread_mutex_init
 
     int pthread_mutex_destroy( pthread_mutex_t *mutex ) __THROW {
-	PthreadLock::destroy< uOwnerLock >( mutex );
+	PthreadLock::destroy< uAdaptiveOwnerLock >( mutex );
 	return 0;
     } // pthread_mutex_destroy
 
@@ -1054,19 +1058,19 @@ extern "C" {
 
 	uDEBUGPRT( uDebugPrt( "pthread_mutex_lock(mutex:%p) enter task:%p\n", mutex, &uThisTask() ); )
 	mutex_check( mutex );
-	PthreadLock::get< uOwnerLock >( mutex )->acquire();
+	PthreadLock::get< uAdaptiveOwnerLock >( mutex )->acquire();
 	return 0;
     } // pthread_mutex_lock
 
     int pthread_mutex_trylock( pthread_mutex_t *mutex ) __THROW {
 	uDEBUGPRT(uDebugPrt( "pthread_mutex_trylock(mutex:%p) enter task:%p\n", mutex, &uThisTask() ); )
 	mutex_check( mutex );
-	return PthreadLock::get< uOwnerLock >( mutex )->tryacquire() ? 0 : EBUSY;
+	return PthreadLock::get< uAdaptiveOwnerLock >( mutex )->tryacquire() ? 0 : EBUSY;
     } // pthread_mutex_trylock
 
     int pthread_mutex_unlock( pthread_mutex_t *mutex ) __THROW {
 	uDEBUGPRT( uDebugPrt( "pthread_mutex_unlock(mutex:%p) enter task:%p\n", mutex, &uThisTask() ); )
-	PthreadLock::get< uOwnerLock >( mutex )->release();
+	PthreadLock::get< uAdaptiveOwnerLock >( mutex )->release();
 	return 0;
     } // pthread_mutex_unlock
 
@@ -1137,14 +1141,14 @@ extern "C" {
     int pthread_cond_wait( pthread_cond_t *cond, pthread_mutex_t *mutex ) {
 	uDEBUGPRT( uDebugPrt( "pthread_cond_wait(cond:%p) mutex:%p enter task:%p\n", cond, mutex, &uThisTask() ); )
 	pthread_testcancel();				// pthread_cond_wait is a cancellation point
-	PthreadLock::get< uCondLock >( cond )->wait( *PthreadLock::get< uOwnerLock >( mutex ) );
+	PthreadLock::get< uCondLock >( cond )->wait( *PthreadLock::get< uAdaptiveOwnerLock >( mutex ) );
 	return 0;
     } // pthread_cond_wait
 
     int pthread_cond_timedwait( pthread_cond_t *cond, pthread_mutex_t *mutex, const struct timespec *abstime ) {
 	uDEBUGPRT( uDebugPrt( "pthread_cond_timedwait(cond:%p) mutex:%p enter task:%p\n", cond, mutex, &uThisTask() ); )
 	pthread_testcancel();				// pthread_cond_timedwait is a cancellation point
-	return PthreadLock::get< uCondLock >( cond )->wait( *PthreadLock::get< uOwnerLock >( mutex ), uTime( *abstime ) ) ? 0 : ETIMEDOUT;
+	return PthreadLock::get< uCondLock >( cond )->wait( *PthreadLock::get< uAdaptiveOwnerLock >( mutex ), uTime( *abstime ) ) ? 0 : ETIMEDOUT;
     } // pthread_cond_timedwait
 
     int pthread_cond_signal( pthread_cond_t *cond ) __THROW {
@@ -32,9 +32,13 @@
 uExecutor * uActor::executor = nullptr;
 uSemaphore uActor::wait_( 0 );				// wait for all actors to be destroyed
 unsigned long int uActor::alive_ = 0;			// number of actor objects in system
+unsigned int uActor::typeIds_ = 0;			// last message-type identifier assigned
+unsigned int uActor::batch_ = uActor::DefaultBatch;	// messages processed per mailbox request
 uActor::StartMsg uActor::startMsg;			// start actor
 uActor::StopMsg uActor::stopMsg;			// terminate actor
 uActor::UnhandledMsg uActor::unhandledMsg;		// tell error
+uActor::PreStartMsg_ uActor::preStartMsg_;		// run preStart
+uActor::RestartMsg_ uActor::restartMsg_;		// run restart
 
 
 // Local Variables: //
@@ -31,6 +31,7 @@
 #include <uDefaultExecutor.h>
 #include <uFuture.h>
 #include <uSemaphore.h>
+#include <type_traits>				// is_same
 
 #ifndef Case
     #define Case( type, msg ) if ( type *msg##_d __attribute__(( unused )) = dynamic_cast< type * >( &msg ) )
@@ -47,10 +48,13 @@ class uActor {
     static uExecutor * executor;			// executor for all actors
     static uSemaphore wait_;				// wait for all actors to delete
     static unsigned long int alive_;			// number of actor objects in system
+    static unsigned int typeIds_;			// last message-type identifier assigned
+    static unsigned int batch_;				// messages processed per mailbox request
   public:
     enum Allocation { Nodelete, Delete, Destroy, Finished }; // allocation actions
+    enum { DefaultBatch = 16, MaxBatch = 64 };		// messages processed per mailbox request
   private:
-    unsigned long int ticket_;				// executor-queue handle to provide FIFO message execution
+    unsigned long int ticket_;				// executor-queue handle for scheduling mailbox
     Allocation allocation;				// allocation action
   public:
     struct Message {
@@ -60,8 +64,26 @@ class uActor {
 	Message( Allocation allocation = Nodelete, uActor * sender = nullptr ) : allocation( allocation ), sender( sender ) {}
 	Message( uActor * sender ) : allocation( Delete ), sender( sender ) {}
 	virtual ~Message() {}
+	virtual unsigned int typeId_() const { return 0; } // 0 => no type identifier, see TypedMessage
     }; // Message
 
+    // Identifiers are dense and assigned on first use, so they index a uActorType::Dispatch table directly.
+
+    template< typename Msg > static unsigned int typeId() {
+	static const unsigned int id = uFetchAdd( typeIds_, 1 ) + 1;
+	return id;
+    } // uActor::typeId
+
+    // A message type derived from TypedMessage< Msg > (or TypedMessage< Msg, Base > to extend another message type)
+    // reports its type identifier through one virtual call, which replaces the dynamic_cast walk of Case for actors
+    // using a Dispatch table. Constructors of Base are inherited.
+
+    template< typename Msg, typename Base = Message > struct TypedMessage : public Base {
+	typedef Msg TypedMessage_;			// registration checks the type is tagged
+	using Base::Base;
+	virtual unsigned int typeId_() const override { return uActor::typeId< Msg >(); }
+    }; // TypedMessage
+
     struct ReplyMsg : public Message {			// base future message
 	ReplyMsg( Allocation allocation = Nodelete, uActor * sender = nullptr ) : Message( allocation, sender ) {}
 	ReplyMsg( uActor * sender ) : Message( sender ) {}
@@ -98,57 +120,191 @@ class uActor {
 	} // switch
     } // checkMsg
 
-    struct Deliver_ {
+    // Messages for an actor queue in its mailbox, and the actor, not each message, is the executor request. A worker
+    // processes up to batch_ messages per request, so the actor's state stays in cache across messages, and then
+    // requeues the actor behind other work if messages remain. A mailbox is in an executor queue at most once, so its
+    // messages are processed in FIFO order by whichever worker, possibly a stealing one, takes the request.
+
+    class Mailbox {
+	enum { Inline = 4 };				// most actors have few pending messages
+	uSpinLock lock;
+	Message ** buf;					// circular buffer, capacity is a power of 2
+	unsigned int capacity, head, count;
+	bool scheduled;					// mailbox in executor queue or being processed
+	Message * inline_[Inline];
+
+	void grow( unsigned int size ) {		// double until size messages fit, lock held
+	    unsigned int ncapacity = capacity;
+	    while ( ncapacity < size ) ncapacity *= 2;
+	  if ( ncapacity == capacity ) return;
+	    Message ** temp = new Message *[ncapacity];
+	    for ( unsigned int i = 0; i < count; i += 1 ) temp[i] = buf[(head + i) & (capacity - 1)];
+	    if ( buf != inline_ ) delete [] buf;
+	    buf = temp;
+	    head = 0;
+	    capacity = ncapacity;
+	} // Mailbox::grow
+      public:
+	Mailbox() : buf( inline_ ), capacity( Inline ), head( 0 ), count( 0 ), scheduled( false ) {}
+
+	~Mailbox() {					// actor deleted => clean up undelivered messages
+	    for ( unsigned int i = 0; i < count; i += 1 ) checkMsg( *buf[(head + i) & (capacity - 1)] );
+	    if ( buf != inline_ ) delete [] buf;
+	} // Mailbox::~Mailbox
+
+	bool insert( Message * msg ) {			// true => mailbox must be scheduled
+	    lock.acquire();
+	    grow( count + 1 );
+	    buf[(head + count) & (capacity - 1)] = msg;
+	    count += 1;
+	    bool schedule = ! scheduled;
+	    scheduled = true;
+	    lock.release();
+	    return schedule;
+	} // Mailbox::insert
+
+	unsigned int remove( Message * msgs[], unsigned int max ) { // take batch with one lock acquire
+	    lock.acquire();
+	    unsigned int n = count < max ? count : max;
+	    for ( unsigned int i = 0; i < n; i += 1 ) msgs[i] = buf[(head + i) & (capacity - 1)];
+	    head = (head + n) & (capacity - 1);
+	    count -= n;
+	    lock.release();
+	    return n;
+	} // Mailbox::remove
+
+	void putBack( Message * msgs[], unsigned int n ) { // return undelivered messages to the front, preserving order
+	    lock.acquire();
+	    grow( count + n );
+	    head = (head - n) & (capacity - 1);
+	    for ( unsigned int i = 0; i < n; i += 1 ) buf[(head + i) & (capacity - 1)] = msgs[i];
+	    count += n;
+	    lock.release();
+	} // Mailbox::putBack
+
+	bool idle() {					// false => messages arrived, mailbox must be rescheduled
+	    lock.acquire();
+	    bool empty = count == 0;
+	    if ( empty ) scheduled = false;
+	    lock.release();
+	    return empty;
+	} // Mailbox::idle
+    }; // Mailbox
+
+    struct Drain_ {
 	uActor & actor;
-	Message & msg;
 
-	Deliver_( uActor & actor, Message & msg ) : actor( actor ), msg( msg ) {}
+	Drain_( uActor & actor ) : actor( actor ) {}
 
 	void operator()() {				// functor
-	    try {
-		actor.allocation = actor.process_( msg ); // call current message handler
-		switch ( actor.allocation ) {		// analyze actor status
-		  case Nodelete: break;
-		  case Delete: delete &actor; break;
-		  case Destroy: actor.~uActor(); break;
-		  case Finished: lastActor(); break;
-		} // switch
-	    } catch ( uBaseEvent &ex ) {
-		Case( uActor::ReplyMsg, msg ) {		// unknown future message
-		    msg_d->delivery( ex.duplicate() );	// complain in future
-		} else {
-		    checkMsg( msg );			// process message
-		    _Throw;				// fail to worker thread
-		} // Case
-	    } catch ( ... ) {
-		abort( "C++ exceptions unsupported from throw in actor for future message" );
-	    // To have a zero-cost try block, the checkMsg call is duplicated above/below.
-	    // } _Finally {
-	    // 	checkMsg( msg );			// process message
-	    } // try
-	    checkMsg( msg );				// process message
-	} // Deliver_::operator()
-    }; // Deliver_
+	    actor.drain_();
+	} // Drain_::operator()
+    }; // Drain_
+
+    // If a message handler raises an exception, the rest of the batch is returned to the mailbox and the mailbox is
+    // rescheduled or marked idle, so the actor keeps receiving messages.
+
+    struct DrainGuard_ {
+	uActor * actor;					// nullptr => batch finished normally
+	Message ** msgs;
+	unsigned int & i;				// message being delivered
+	unsigned int n;
+
+	DrainGuard_( uActor & actor, Message * msgs[], unsigned int & i, unsigned int n ) : actor( &actor ), msgs( msgs ), i( i ), n( n ) {}
+
+	~DrainGuard_() {
+	  if ( actor == nullptr ) return;
+	    actor->mailbox_.putBack( msgs + i + 1, n - i - 1 ); // message i raised the exception
+	    if ( ! actor->mailbox_.idle() ) executor->send( Drain_( *actor ), actor->ticket_ );
+	} // DrainGuard_::~DrainGuard_
+    }; // DrainGuard_
+
+    Mailbox mailbox_;
+
+    Allocation deliver_( Message & msg ) {
+	if ( &msg == &preStartMsg_ ) {			// administration messages
+	    preStart();
+	    return Nodelete;
+	} else if ( &msg == &restartMsg_ ) {
+	    restart_();
+	    return Nodelete;
+	} // if
+
+	Allocation action = Nodelete;
+	try {
+	    action = allocation = process_( msg );	// call current message handler
+	    switch ( action ) {				// analyze actor status
+	      case Nodelete: break;
+	      case Delete: delete this; break;
+	      case Destroy: this->~uActor(); break;
+	      case Finished: lastActor(); break;
+	    } // switch
+	} catch ( uBaseEvent &ex ) {
+	    Case( uActor::ReplyMsg, msg ) {		// unknown future message
+		msg_d->delivery( ex.duplicate() );	// complain in future
+	    } else {
+		checkMsg( msg );			// process message
+		_Throw;					// fail to worker thread
+	    } // Case
+	} catch ( ... ) {
+	    abort( "C++ exceptions unsupported from throw in actor for future message" );
+	// To have a zero-cost try block, the checkMsg call is duplicated above/below.
+	// } _Finally {
+	// 	checkMsg( msg );			// process message
+	} // try
+	checkMsg( msg );				// process message
+	return action;
+    } // uActor::deliver_
+
+    // A finished actor no longer processes messages, so messages arriving after it finishes are cleaned up without
+    // delivery. A deleted actor's remaining messages are cleaned up here and by the mailbox destructor.
+
+    void drain_() {
+	Message * msgs[MaxBatch];
+	unsigned int n = mailbox_.remove( msgs, batch_ ), i = 0;
+	DrainGuard_ guard( *this, msgs, i, n );
+	for ( ; i < n; i += 1 ) {
+	    if ( allocation == Finished ) {		// actor finished ? => discard
+		checkMsg( *msgs[i] );
+		continue;
+	    } // if
+	    Allocation action = deliver_( *msgs[i] );
+	    if ( action == Delete || action == Destroy ) { // actor deleted => mailbox gone
+		guard.actor = nullptr;
+		for ( i += 1; i < n; i += 1 ) checkMsg( *msgs[i] );
+		return;
+	    } // if
+	} // for
+	guard.actor = nullptr;
+	if ( ! mailbox_.idle() ) executor->send( Drain_( *this ), ticket_ ); // more messages ? => requeue
+    } // uActor::drain_
 
     virtual Allocation process_( Message & msg ) = 0;	// type-safe access to subclass receivePtr
+    virtual void restart_() = 0;			// reset subclass to initial message handler
   protected:
+    static struct PreStartMsg_ : public uActor::Message {} preStartMsg_; // run preStart in message order
+    static struct RestartMsg_ : public uActor::Message {} restartMsg_; // run restart in message order
+
+    void post_( Message & msg ) {			// append to mailbox, schedule mailbox if idle
+	if ( mailbox_.insert( &msg ) ) executor->send( Drain_( *this ), ticket_ );
+    } // uActor::post_
+
     // Do NOT make pure to allow replacement by "become" in constructor.
     virtual Allocation receive( Message & ) {		// user supplied message handler
 	abort( "must supply receive routine for actor" );
 	return Delete;
     };
-    template< typename Func > void send_( Func action ) { executor->send( action, ticket_ ); }
     virtual void preStart() { /* default empty */ };	// user supplied actor initialization
 
     struct uActorConstructor {				// translator creates instance in actor constructor
 	uActorConstructor( UPP::uAction action, uActor &actor ) {
 	    if ( action == UPP::uYes ) {
-		actor.send_( [&actor]() { actor.preStart(); } ); // send preStart call
+		actor.post_( preStartMsg_ );		// send preStart call
 	    } // if
 	} // uActorConstructor::uActorConstructor
     }; // uActorConstructor
   public:
-    uActor() {
+    uActor() : allocation( Nodelete ) {
 	uFetchAdd( alive_, 1 );				// number of actors in system
 	uDEBUG( if ( ! executor ) { abort( "Attempt to create actor but no actor executor exists.\nPossible cause is not calling uActorStart() or calling it to late." ); } );
 	ticket_ = executor->tickets();			// get executor queue handle
@@ -162,7 +318,7 @@ class uActor {
 
     uActor & tell( Message & msg, uActor * sender = nullptr ) { // async call, no return
 	msg.sender = sender;
-	executor->send( Deliver_( *this, msg ), ticket_ ); // copy functor
+	post_( msg );
 	return *this;
     } // uActor::tell
 
@@ -172,7 +328,7 @@ class uActor {
 
     template< typename Result > Future_ISM< Result > ask( FutureMessage< Result > & msg, uActor * sender = nullptr ) { // async call, return future
 	msg.sender = sender;
-	executor->send( Deliver_( *this, msg ), ticket_ );
+	post_( msg );
 	return msg.result;
     } // uActor::ask
 
@@ -184,9 +340,10 @@ class uActor {
 
     // use processors on current cluster
 #   define uActorStart() uExecutor __uExecutor__( 0, uThisCluster().getProcessors(), false, -1 ); uActor::start( __uExecutor__ )
-    static void start( uExecutor & executor ) {		// wait for all actors to terminate or timeout
+    static void start( uExecutor & executor, unsigned int batch = DefaultBatch ) { // batch: messages per mailbox request
 	assert( ! uActor::executor );
 	uActor::executor = &executor;
+	uActor::batch_ = batch == 0 ? 1 : batch > MaxBatch ? MaxBatch : batch;
     } // uActor::start
 
 #   define uActorStop() uActor::stop()
@@ -201,12 +358,12 @@ class uActor {
 	return stopped;					// true => stop, false => timeout
     } // uActor::stop
 
-    static struct StartMsg : public uActor::Message {} startMsg; // start actor
-    static struct StopMsg : public uActor::Message {} stopMsg; // terminate actor
+    static struct StartMsg : public uActor::TypedMessage< StartMsg > {} startMsg; // start actor
+    static struct StopMsg : public uActor::TypedMessage< StopMsg > {} stopMsg; // terminate actor
 
     // Error handling
 
-    static struct UnhandledMsg : public uActor::Message {} unhandledMsg; // tell error
+    static struct UnhandledMsg : public uActor::TypedMessage< UnhandledMsg > {} unhandledMsg; // tell error
 
     _Event Unhandled {					// ask error
       public:
@@ -219,15 +376,85 @@ class uActor {
 template< typename Actor > class uActorType : public uActor {
   protected:
     typedef Allocation (Actor:: * Handler)( Message & msg ); // message handler type
+
+    // Jump table from message-type identifier to typed handler, e.g.:
+    //
+    //   static Dispatch dispatch( &Server::add, &Server::remove, &Server::stop ); // handlers take AddMsg &, ...
+    //   become( dispatch );
+    //
+    // A message is routed with one virtual call and one indexed load. Untyped messages, and typed messages without a
+    // handler in the table, go to the table's otherwise handler, a handler taking Message & (default receive), so Case
+    // chains still work for them. A table is normally a function static shared by all actors of a type and must
+    // outlive them; handlers are registered before the table is used. restart() returns an actor to receive, so an
+    // actor that is restarted installs its table in preStart.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-function-type"	// typed handlers round trip through Handler
+    class Dispatch {
+	typedef Allocation (* Call)( Actor &, Handler, Message & );
+
+	struct Entry {
+	    Handler handler;				// typed handler stored as untyped handler
+	    Call call;					// restores handler and message types, nullptr => no handler
+	}; // Entry
+
+	Entry * entries = nullptr;
+	unsigned int size = 0;
+	Handler otherwise_ = &uActorType<Actor>::receive;
+
+	template< typename Msg > static Allocation call( Actor & actor, Handler handler, Message & msg ) {
+	    return (actor.*reinterpret_cast< Allocation (Actor:: *)( Msg & ) >( handler ))( static_cast< Msg & >( msg ) );
+	} // uActorType::Dispatch::call
+      public:
+	template< typename... Handlers > Dispatch( Handlers... handlers ) { // register each handler
+	    int unused[] __attribute__(( unused )) = { 0, ( on( handlers ), 0 )... };
+	} // uActorType::Dispatch::Dispatch
+
+	Dispatch( const Dispatch & ) = delete;
+	Dispatch & operator=( const Dispatch & ) = delete;
+
+	~Dispatch() {
+	    delete [] entries;
+	} // uActorType::Dispatch::~Dispatch
+
+	template< typename Msg > Dispatch & on( Allocation (Actor:: * handler)( Msg & ) ) {
+	    static_assert( std::is_same< typename Msg::TypedMessage_, Msg >::value, "Dispatch handler message type must derive from uActor::TypedMessage< type >." );
+	    unsigned int id = uActor::typeId< Msg >();
+	    if ( id >= size ) {				// identifiers are dense, so table stays small
+		Entry * temp = new Entry[id + 1]();
+		for ( unsigned int i = 0; i < size; i += 1 ) temp[i] = entries[i];
+		delete [] entries;
+		entries = temp;
+		size = id + 1;
+	    } // if
+	    entries[id] = { reinterpret_cast< Handler >( handler ), call< Msg > };
+	    return *this;
+	} // uActorType::Dispatch::on
+
+	Dispatch & on( Handler handler ) {		// untyped handler => otherwise
+	    otherwise_ = handler;
+	    return *this;
+	} // uActorType::Dispatch::on
+
+	Allocation operator()( Actor & actor, Message & msg ) const {
+	    unsigned int id = msg.typeId_();
+	    if ( id < size && entries[id].call != nullptr ) return entries[id].call( actor, entries[id].handler, msg );
+	    return (actor.*otherwise_)( msg );
+	} // uActorType::Dispatch::operator()
+    }; // uActorType::Dispatch
+#pragma GCC diagnostic pop
   private:
     Handler receivePtr_ = &uActorType<Actor>::receive;	// message handler pointer
+    const Dispatch * dispatch_ = nullptr;		// message-type table, nullptr => receivePtr_
 
     virtual Allocation process_( Message & msg ) override final {
+	if ( dispatch_ != nullptr ) return (*dispatch_)( *(Actor *)this, msg );
 	return (((Actor *)this)->*receivePtr_)(msg);
     } // uActorType::process
 
-    void restart_() {
+    virtual void restart_() override final {
 	receivePtr_ = &uActorType<Actor>::receive;	// restart message-handler pointer
+	dispatch_ = nullptr;
 	preStart();					// rerun preStart
     } // uActorType::restart_
   protected:
@@ -236,13 +463,20 @@ template< typename Actor > class uActorType : public uActor {
     Handler become( Handler handler ) {			// dynamically change message handler
 	Handler temp = receivePtr_;
 	receivePtr_ = handler;
+	dispatch_ = nullptr;
 	return temp;					// return previous message handler
     } // uActorType::become
+
+    const Dispatch * become( const Dispatch & dispatch ) { // dynamically change to message-type table
+	const Dispatch * temp = dispatch_;
+	dispatch_ = &dispatch;
+	return temp;					// return previous table, nullptr => handler
+    } // uActorType::become
   public:
     // Administration
 
     void restart() {					// reset actor to initial state
-	send_( [this]() { this->restart_(); } );	// run restart message
+	post_( restartMsg_ );				// run restart message
     } // uActorType::restart
 }; // uActorType
 
@@ -0,0 +1,473 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// uCoTask.h -- Stackless C++20 coroutine tasks multiplexed on uC++ tasks
+//
+// Author           :
+// Created On       : Sun Oct 18 15:24:38 2026
+// Last Modified By :
+// Last Modified On : Sun Oct 18 15:24:38 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+
+#pragma once
+
+
+#if defined( __cpp_impl_coroutine )			// compile with -std=c++20
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+#include <cstring>					// strerror
+#include <unistd.h>					// read, write
+#include <fcntl.h>					// fcntl
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <uFuture.h>
+#include <uFile.h>
+
+
+// A uCoTask is a coroutine whose frame lives in the heap rather than on a stack, so thousands of handlers cost a few
+// hundred bytes each instead of a task stack each. Spawned uCoTasks are run by a uCoScheduler, whose carrier tasks
+// resume ready coroutines on the processors of a cluster. A coroutine that waits (for a file descriptor, a future or a
+// uCoSemaphore) suspends and releases its carrier; whoever makes the wait end puts it back on the ready queue. A
+// uCoTask awaited by another coroutine runs directly on the awaiting coroutine's carrier, without the ready queue.
+
+
+class uCoScheduler;
+
+struct uCoPromiseBase : public uColable {		// scheduling state of one coroutine frame
+    uCoScheduler *scheduler = nullptr;			// runs this coroutine
+    std::coroutine_handle<> self;			// resumed when scheduled
+    std::coroutine_handle<> continuation;		// awaiting coroutine, null => spawned
+    std::exception_ptr exception;
+
+    struct Final {					// continue awaiting coroutine or release spawned frame
+	bool await_ready() noexcept { return false; }
+
+	template<typename Promise> std::coroutine_handle<> await_suspend( std::coroutine_handle<Promise> frame ) noexcept {
+	    if ( frame.promise().continuation ) return frame.promise().continuation;
+	    frame.promise().scheduler->finished( frame.promise() );
+	    return std::noop_coroutine();
+	} // Final::await_suspend
+
+	void await_resume() noexcept {}
+    }; // Final
+
+    std::suspend_always initial_suspend() noexcept { return {}; } // start when awaited or spawned
+    Final final_suspend() noexcept { return {}; }
+    void unhandled_exception() { exception = std::current_exception(); }
+}; // uCoPromiseBase
+
+template<typename T> struct uCoResult : public uCoPromiseBase {
+    std::optional<T> value;
+
+    void return_value( T v ) { value.emplace( std::move( v ) ); }
+
+    T result() {
+	if ( exception ) std::rethrow_exception( exception );
+	return std::move( *value );
+    } // uCoResult::result
+}; // uCoResult
+
+template<> struct uCoResult<void> : public uCoPromiseBase {
+    void return_void() {}
+
+    void result() {
+	if ( exception ) std::rethrow_exception( exception );
+    } // uCoResult::result
+}; // uCoResult
+
+
+//######################### uCoTask #########################
+
+
+template<typename T = void> class uCoTask {
+    friend class uCoScheduler;
+  public:
+    struct promise_type : public uCoResult<T> {
+	uCoTask get_return_object() {
+	    std::coroutine_handle<promise_type> frame = std::coroutine_handle<promise_type>::from_promise( *this );
+	    this->self = frame;
+	    return uCoTask( frame );
+	} // promise_type::get_return_object
+    }; // promise_type
+  private:
+    std::coroutine_handle<promise_type> frame;
+
+    explicit uCoTask( std::coroutine_handle<promise_type> frame ) : frame( frame ) {}
+  public:
+    uCoTask( const uCoTask & ) = delete;		// no copy
+    uCoTask &operator=( const uCoTask & ) = delete;	// no assignment
+
+    uCoTask( uCoTask &&other ) : frame( std::exchange( other.frame, nullptr ) ) {}
+
+    ~uCoTask() {
+	if ( frame ) frame.destroy();
+    } // uCoTask::~uCoTask
+
+    struct Awaiter {					// run child on awaiting coroutine's carrier
+	std::coroutine_handle<promise_type> child;
+
+	bool await_ready() { return false; }
+
+	template<typename Promise> std::coroutine_handle<> await_suspend( std::coroutine_handle<Promise> parent ) {
+	    child.promise().continuation = parent;
+	    child.promise().scheduler = parent.promise().scheduler;
+	    return child;
+	} // Awaiter::await_suspend
+
+	T await_resume() { return child.promise().result(); }
+    }; // Awaiter
+
+    Awaiter operator co_await() {
+	return Awaiter{ frame };
+    } // uCoTask::operator co_await
+}; // uCoTask
+
+
+//######################### uCoScheduler #########################
+
+
+_Task uCoCarrier;
+_Task uCoPoller;
+
+class uCoScheduler {
+    friend struct uCoPromiseBase;			// access: finished
+    friend _Task uCoCarrier;				// access: next
+    friend _Task uCoPoller;				// access: epfd, efd
+
+    uOwnerLock mutex;
+    uCondLock work, quiet;				// carriers wait for ready coroutines, destructor for live == 0
+    uQueue<uCoPromiseBase> ready;
+    unsigned int live;					// spawned coroutines not finished
+    bool stop;
+    const unsigned int ncarriers;
+    uCoCarrier **carriers;
+    int epfd, efd;					// descriptors awaited by coroutines, poller shutdown
+    uCoPoller *poller;
+
+    uCoPromiseBase *next();
+    void finished( uCoPromiseBase &promise );
+  public:
+    uCoScheduler( const uCoScheduler & ) = delete;	// no copy
+    uCoScheduler( uCoScheduler && ) = delete;
+    uCoScheduler &operator=( const uCoScheduler & ) = delete; // no assignment
+
+    uCoScheduler( unsigned int carriers = 1, uCluster &cluster = uThisCluster() );
+    ~uCoScheduler();					// wait for spawned coroutines to finish
+
+    void spawn( uCoTask<> &&task );			// scheduler owns frame
+    void schedule( uCoPromiseBase &promise );		// make suspended coroutine ready
+    void wait( int fd, int rwe, uCoPromiseBase &promise ); // schedule when fd is ready
+    void drain();					// wait for spawned coroutines to finish
+}; // uCoScheduler
+
+
+_Task uCoCarrier {					// resume ready coroutines until scheduler stops
+    uCoScheduler &scheduler;
+
+    void main() {
+	for ( ;; ) {
+	    uCoPromiseBase *promise = scheduler.next();
+	  if ( promise == nullptr ) break;		// stopping ?
+	    promise->self.resume();
+	} // for
+    } // uCoCarrier::main
+  public:
+    uCoCarrier( uCoScheduler &scheduler, uCluster &cluster ) : uBaseTask( cluster ), scheduler( scheduler ) {}
+}; // uCoCarrier
+
+
+// The poller blocks only itself in the cluster's I/O poller until the epoll descriptor is readable, so one task covers
+// every descriptor awaited by the scheduler's coroutines. Registrations are one-shot and carry the waiting promise.
+
+_Task uCoPoller {
+    uCoScheduler &scheduler;
+
+    void main() {
+	enum { Events = 64 };
+	epoll_event events[Events];
+	for ( ;; ) {
+	    uThisCluster().select( scheduler.epfd, uCluster::ReadSelect );
+	    int n = epoll_wait( scheduler.epfd, events, Events, 0 );
+	    bool shutdown = false;
+	    for ( int i = 0; i < n; i += 1 ) {
+		if ( events[i].data.ptr == nullptr ) shutdown = true;
+		else scheduler.schedule( *(uCoPromiseBase *)events[i].data.ptr );
+	    } // for
+	  if ( shutdown ) break;
+	} // for
+    } // uCoPoller::main
+  public:
+    uCoPoller( uCoScheduler &scheduler, uCluster &cluster ) : uBaseTask( cluster ), scheduler( scheduler ) {}
+}; // uCoPoller
+
+
+inline uCoScheduler::uCoScheduler( unsigned int carriers, uCluster &cluster ) : live( 0 ), stop( false ), ncarriers( carriers ), poller( nullptr ) {
+    epfd = epoll_create1( EPOLL_CLOEXEC );
+    efd = eventfd( 0, EFD_CLOEXEC | EFD_NONBLOCK );
+    if ( epfd == -1 || efd == -1 ) abort( "uCoScheduler : unable to create epoll descriptors, error(%d) %s.", errno, strerror( errno ) );
+    epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.ptr = nullptr;				// shutdown marker
+    epoll_ctl( epfd, EPOLL_CTL_ADD, efd, &ev );
+    poller = new uCoPoller( *this, cluster );
+    this->carriers = new uCoCarrier *[ncarriers];
+    for ( unsigned int i = 0; i < ncarriers; i += 1 ) {
+	this->carriers[i] = new uCoCarrier( *this, cluster );
+    } // for
+} // uCoScheduler::uCoScheduler
+
+inline uCoScheduler::~uCoScheduler() {
+    drain();
+    mutex.acquire();
+    stop = true;
+    work.broadcast();
+    mutex.release();
+    for ( unsigned int i = 0; i < ncarriers; i += 1 ) delete carriers[i];
+    delete [] carriers;
+    uint64_t one = 1;
+    if ( ::write( efd, &one, sizeof(one) ) != sizeof(one) ) abort( "uCoScheduler : unable to stop poller." );
+    delete poller;
+    ::close( efd );
+    ::close( epfd );
+} // uCoScheduler::~uCoScheduler
+
+inline uCoPromiseBase *uCoScheduler::next() {
+    mutex.acquire();
+    while ( ready.empty() && ! stop ) work.wait( mutex );
+    uCoPromiseBase *promise = ready.empty() ? nullptr : ready.drop();
+    mutex.release();
+    return promise;
+} // uCoScheduler::next
+
+inline void uCoScheduler::finished( uCoPromiseBase &promise ) {
+    if ( promise.exception ) abort( "uCoScheduler : spawned coroutine ended with an unhandled exception." );
+    promise.self.destroy();
+    mutex.acquire();
+    live -= 1;
+    if ( live == 0 ) quiet.broadcast();
+    mutex.release();
+} // uCoScheduler::finished
+
+inline void uCoScheduler::spawn( uCoTask<> &&task ) {
+    uCoPromiseBase &promise = std::exchange( task.frame, nullptr ).promise();
+    promise.scheduler = this;
+    mutex.acquire();
+    live += 1;
+    mutex.release();
+    schedule( promise );
+} // uCoScheduler::spawn
+
+inline void uCoScheduler::schedule( uCoPromiseBase &promise ) {
+    mutex.acquire();
+    ready.add( &promise );
+    work.signal();
+    mutex.release();
+} // uCoScheduler::schedule
+
+inline void uCoScheduler::wait( int fd, int rwe, uCoPromiseBase &promise ) {
+    epoll_event ev;
+    ev.events = EPOLLONESHOT;
+    if ( rwe & uCluster::ReadSelect ) ev.events |= EPOLLIN | EPOLLRDHUP;
+    if ( rwe & uCluster::WriteSelect ) ev.events |= EPOLLOUT;
+    if ( rwe & uCluster::ExceptSelect ) ev.events |= EPOLLPRI;
+    ev.data.ptr = &promise;
+    if ( epoll_ctl( epfd, EPOLL_CTL_MOD, fd, &ev ) == -1 ) { // rearm, first wait adds
+	if ( errno != ENOENT || epoll_ctl( epfd, EPOLL_CTL_ADD, fd, &ev ) == -1 ) {
+	    schedule( promise );			// not pollable (e.g., regular file) => always ready
+	} // if
+    } // if
+} // uCoScheduler::wait
+
+inline void uCoScheduler::drain() {
+    mutex.acquire();
+    while ( live != 0 ) quiet.wait( mutex );
+    mutex.release();
+} // uCoScheduler::drain
+
+
+//######################### awaitables #########################
+
+
+struct uCoYield {					// let other ready coroutines run
+    bool await_ready() { return false; }
+
+    template<typename Promise> void await_suspend( std::coroutine_handle<Promise> frame ) {
+	frame.promise().scheduler->schedule( frame.promise() );
+    } // uCoYield::await_suspend
+
+    void await_resume() {}
+}; // uCoYield
+
+
+class uCoReady {					// wait until a descriptor is ready, one waiting coroutine per descriptor
+    int fd, rwe;
+  public:
+    uCoReady( int fd, int rwe ) : fd( fd ), rwe( rwe ) {}
+
+    bool await_ready() { return false; }
+
+    template<typename Promise> void await_suspend( std::coroutine_handle<Promise> frame ) {
+	frame.promise().scheduler->wait( fd, rwe, frame.promise() );
+    } // uCoReady::await_suspend
+
+    void await_resume() {}
+}; // uCoReady
+
+
+// A future signals its select clients after the result is made available, so the waiting coroutine is scheduled by
+// the delivering task and reads the result without blocking.
+
+template<typename Future> class uCoAwait : public UPP::BaseFutureDL {
+    Future &future;
+    uCoPromiseBase *promise;
+    bool registered;
+
+    void signal() { promise->scheduler->schedule( *promise ); }
+  public:
+    uCoAwait( Future &future ) : future( future ), promise( nullptr ), registered( false ) {}
+
+    bool await_ready() { return future.available(); }
+
+    // Once registered, the coroutine may be resumed by another carrier before await_suspend returns, so no member is
+    // touched after a successful registration.
+
+    template<typename Promise> bool await_suspend( std::coroutine_handle<Promise> frame ) {
+	promise = &frame.promise();
+	registered = true;
+      if ( ! future.addSelect( this ) ) return true;
+	registered = false;				// available during registration => continue
+	return false;
+    } // uCoAwait::await_suspend
+
+    auto await_resume() {
+	if ( registered ) future.removeSelect( this );
+	return future();
+    } // uCoAwait::await_resume
+}; // uCoAwait
+
+
+// uSemaphore blocks the calling task, which would block a carrier and every coroutine behind it, so coroutines
+// synchronize with uCoSemaphore. V may be called by coroutines or ordinary tasks.
+
+class uCoSemaphore {
+    uSpinLock lock;
+    int count;
+    uQueue<uCoPromiseBase> waiting;
+  public:
+    uCoSemaphore( int count = 1 ) : count( count ) {}
+
+    bool TryP() {
+	lock.acquire();
+	bool acquired = count > 0;
+	if ( acquired ) count -= 1;
+	lock.release();
+	return acquired;
+    } // uCoSemaphore::TryP
+
+    struct Awaiter {
+	uCoSemaphore &sem;
+
+	bool await_ready() { return false; }
+
+	template<typename Promise> bool await_suspend( std::coroutine_handle<Promise> frame ) {
+	    sem.lock.acquire();
+	    if ( sem.count > 0 ) {			// acquire without suspending
+		sem.count -= 1;
+		sem.lock.release();
+		return false;
+	    } // if
+	    sem.waiting.add( &frame.promise() );
+	    sem.lock.release();
+	    return true;
+	} // Awaiter::await_suspend
+
+	void await_resume() {}
+    }; // Awaiter
+
+    Awaiter P() {					// co_await sem.P()
+	return Awaiter{ *this };
+    } // uCoSemaphore::P
+
+    void V() {						// pass count directly to a waiting coroutine
+	lock.acquire();
+	if ( waiting.empty() ) {
+	    count += 1;
+	    lock.release();
+	    return;
+	} // if
+	uCoPromiseBase *promise = waiting.drop();
+	lock.release();
+	promise->scheduler->schedule( *promise );
+    } // uCoSemaphore::V
+
+    int counter() const {
+	return count;
+    } // uCoSemaphore::counter
+}; // uCoSemaphore
+
+
+//######################### I/O #########################
+
+
+// Read and write with the errno conventions of read(2) and write(2). A nonblocking descriptor is tried before
+// waiting, so a ready descriptor costs no wait; a blocking descriptor waits first so the call cannot block the carrier.
+
+inline bool uCoNonblocking( int fd ) {
+    int flags = fcntl( fd, F_GETFL );
+    return flags != -1 && (flags & O_NONBLOCK);
+} // uCoNonblocking
+
+inline uCoTask<ssize_t> uCoRead( uFileIO &file, void *buf, size_t len ) {
+    int fd = file.fd();
+    bool wait = ! uCoNonblocking( fd );
+    for ( ;; ) {
+	if ( wait ) co_await uCoReady( fd, uCluster::ReadSelect );
+	ssize_t rlen = ::read( fd, buf, len );
+      if ( rlen != -1 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) ) co_return rlen;
+	wait = true;
+    } // for
+} // uCoRead
+
+inline uCoTask<ssize_t> uCoWrite( uFileIO &file, const void *buf, size_t len ) { // write all unless error
+    int fd = file.fd();
+    bool nonblocking = uCoNonblocking( fd ), wait = ! nonblocking;
+    size_t done = 0;
+    while ( done < len ) {
+	if ( wait ) co_await uCoReady( fd, uCluster::WriteSelect );
+	ssize_t wlen = ::write( fd, (const char *)buf + done, len - done );
+	if ( wlen == -1 ) {
+	  if ( errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR ) co_return -1;
+	    wait = true;
+	} else {
+	    done += wlen;
+	    wait = ! nonblocking;			// partial write => retry nonblocking before waiting
+	} // if
+    } // while
+    co_return done;
+} // uCoWrite
+
+#endif // __cpp_impl_coroutine
+
+
+// Local Variables: //
+// compile-command: "make install" //
+// End: //
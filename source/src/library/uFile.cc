@@ -37,6 +37,7 @@ using std::min;
 #include <cstring>					// strerror
 #include <unistd.h>					// read, write, close, etc.
 #include <sys/uio.h>					// readv, writev
+#include <poll.h>					// poll
 
 
 //######################### uFileIO #########################
@@ -225,6 +226,141 @@ int uFileIO::writev( const struct iovec *iov, int iovcnt, uDuration *timeout ) {
 } // uFileIO::writev
 
 
+// A splice/tee returning EAGAIN means either the source has no data or the destination is full. A closure can only
+// select on one descriptor, so a zero-timeout poll determines the blocking side. Like uSocketIO::sendfile, the IOPoller
+// does not perform the transfer when the descriptor becomes ready because the transfer may block on disk I/O while
+// holding the uNBIO lock; instead, the waiting task retries the transfer.
+
+void uFileIO::spliceWait( uFileIO &src, size_t len, uDuration *timeout, const char *const op ) {
+    struct Ready : public uIOClosure {
+	int action() { return 0; }			// transfer retried by waiting task
+	Ready( uIOaccess &access, int &retcode ) : uIOClosure( access, retcode ) {}
+    }; // Ready
+
+    int retcode;
+    pollfd fds[2] = { { src.access.fd, POLLIN, 0 }, { access.fd, POLLOUT, 0 } };
+
+    for ( ;; ) {
+	retcode = ::poll( fds, 2, 0 );
+      if ( retcode != -1 || errno != EINTR ) break;	// timer interrupt ?
+    } // for
+    if ( retcode == -1 ) return;			// retry transfer, which reports the error
+
+    if ( (fds[0].revents & (POLLIN | POLLHUP | POLLERR)) == 0 ) { // source empty ?
+	Ready ready( src.access, retcode );
+	if ( ! ready.select( uCluster::ReadSelect, timeout ) ) {
+	    src.readTimeout( nullptr, len, timeout, op );
+	} // if
+    } else if ( (fds[1].revents & (POLLOUT | POLLERR)) == 0 ) { // destination full ?
+	Ready ready( access, retcode );
+	if ( ! ready.select( uCluster::WriteSelect, timeout ) ) {
+	    writeTimeout( nullptr, len, timeout, op );
+	} // if
+    } else {
+	uThisTask().yield();				// both sides ready => transient, allow other tasks to make progress
+    } // if
+} // uFileIO::spliceWait
+
+
+ssize_t uFileIO::splice( uFileIO &src, loff_t *srcoff, loff_t *dstoff, size_t len, unsigned int flags, uDuration *timeout ) {
+    int ret;
+    ssize_t slen;
+
+    struct Splice : public uIOClosure {
+	uIOaccess &src;
+	loff_t *srcoff, *dstoff;
+	size_t len;
+	unsigned int flags;
+	ssize_t &slen;
+
+	int action() {
+#ifdef __U_STATISTICS__
+	    uFetchAdd( UPP::Statistics::splice_syscalls, 1 );
+#endif // __U_STATISTICS__
+	    if ( src.poll.getStatus() == uPoll::PollOnDemand ) src.poll.setPollFlag( src.fd );
+	    slen = ::splice( src.fd, srcoff, access.fd, dstoff, len, flags | SPLICE_F_NONBLOCK );
+	    int terrno = errno;				// preserve errno across fcntl
+	    if ( src.poll.getStatus() == uPoll::PollOnDemand ) src.poll.clearPollFlag( src.fd );
+	    errno = terrno;
+	    return slen == -1 ? -1 : 0;
+	} // action
+	Splice( uIOaccess &access, int &ret, uIOaccess &src, loff_t *srcoff, loff_t *dstoff, size_t len, unsigned int flags, ssize_t &slen ) :
+	    uIOClosure( access, ret ), src( src ), srcoff( srcoff ), dstoff( dstoff ), len( len ), flags( flags ), slen( slen ) {}
+    } spliceClosure( access, ret, src.access, srcoff, dstoff, len, flags, slen );
+
+    for ( ;; ) {
+	spliceClosure.wrapper();
+      if ( ret != -1 || spliceClosure.errno_ != U_EWOULDBLOCK ) break;
+#ifdef __U_STATISTICS__
+	uFetchAdd( UPP::Statistics::splice_eagain, 1 );
+#endif // __U_STATISTICS__
+	spliceWait( src, len, timeout, "splice" );
+    } // for
+    if ( ret == -1 ) {
+	writeFailure( spliceClosure.errno_, nullptr, len, timeout, "splice" );
+    } // if
+
+#ifdef __U_STATISTICS__
+    uFetchAdd( UPP::Statistics::splice_bytes, slen );
+#endif // __U_STATISTICS__
+    return slen;					// 0 => end of file on src
+} // uFileIO::splice
+
+
+ssize_t uFileIO::splice( uFileIO &src, uPipe &pipe, size_t len, uDuration *timeout ) {
+    // splice requires one side to be a pipe, so general file/socket to socket transfer moves the data through a pipe
+    // as an in-kernel buffer. Transfer stops after len bytes or at end of file on src.
+
+    size_t count;
+    for ( count = 0; count < len; ) {
+	ssize_t in = pipe.right().splice( src, nullptr, nullptr, len - count, SPLICE_F_MOVE | SPLICE_F_MORE, timeout );
+      if ( in == 0 ) break;				// end of file ?
+	for ( ssize_t out = 0; out < in; ) {		// drain pipe
+	    out += splice( pipe.left(), nullptr, nullptr, in - out, SPLICE_F_MOVE | SPLICE_F_MORE, timeout );
+	} // for
+	count += in;
+    } // for
+    return count;
+} // uFileIO::splice
+
+
+ssize_t uFileIO::tee( uFileIO &src, size_t len, unsigned int flags, uDuration *timeout ) {
+    int ret;
+    ssize_t tlen;
+
+    struct Tee : public uIOClosure {
+	int srcfd;
+	size_t len;
+	unsigned int flags;
+	ssize_t &tlen;
+
+	int action() {
+#ifdef __U_STATISTICS__
+	    uFetchAdd( UPP::Statistics::splice_syscalls, 1 );
+#endif // __U_STATISTICS__
+	    tlen = ::tee( srcfd, access.fd, len, flags | SPLICE_F_NONBLOCK );
+	    return tlen == -1 ? -1 : 0;
+	} // action
+	Tee( uIOaccess &access, int &ret, int srcfd, size_t len, unsigned int flags, ssize_t &tlen ) :
+	    uIOClosure( access, ret ), srcfd( srcfd ), len( len ), flags( flags ), tlen( tlen ) {}
+    } teeClosure( access, ret, src.access.fd, len, flags, tlen );
+
+    for ( ;; ) {
+	teeClosure.wrapper();
+      if ( ret != -1 || teeClosure.errno_ != U_EWOULDBLOCK ) break;
+#ifdef __U_STATISTICS__
+	uFetchAdd( UPP::Statistics::splice_eagain, 1 );
+#endif // __U_STATISTICS__
+	spliceWait( src, len, timeout, "tee" );
+    } // for
+    if ( ret == -1 ) {
+	writeFailure( teeClosure.errno_, nullptr, len, timeout, "tee" );
+    } // if
+
+    return tlen;					// duplicated bytes, src data is not consumed
+} // uFileIO::tee
+
+
 //######################### FileAccess #########################
 
 
@@ -38,6 +38,8 @@
 //######################### uFileIO #########################
 
 
+class uPipe;						// forward declaration
+
 class uFileIO {						// monitor
   protected:
     uIOaccess &access;
@@ -54,12 +56,19 @@ class uFileIO {						// monitor
 
     virtual ~uFileIO() {
     } // uFileIO::~uFileIO
+
+    void spliceWait( uFileIO &src, size_t len, uDuration *timeout, const char *const op );
   public:
     int read( char *buf, int len, uDuration *timeout = nullptr );
     int readv( const struct iovec *iov, int iovcnt, uDuration *timeout = nullptr );
     _Mutex int write( const char *buf, int len, uDuration *timeout = nullptr );
     int writev( const struct iovec *iov, int iovcnt, uDuration *timeout = nullptr );
 
+    // Zero-copy transfer from src to this file, where src or this file must be a pipe (see splice(2) and tee(2)).
+    ssize_t splice( uFileIO &src, loff_t *srcoff, loff_t *dstoff, size_t len, unsigned int flags = 0, uDuration *timeout = nullptr );
+    ssize_t splice( uFileIO &src, uPipe &pipe, size_t len, uDuration *timeout = nullptr );
+    ssize_t tee( uFileIO &src, size_t len, unsigned int flags = 0, uDuration *timeout = nullptr );
+
     int fd() {
 	return access.fd;
     } // uFileIO::fd
@@ -112,6 +121,7 @@ class uFile {
     class FileAccess : public uFileIO {		// monitor
 	template< typename char_t, typename traits > friend class std::basic_filebuf; // access: constructor
 	friend class uSocketIO;				// access: access
+	friend class uLogger;				// access: constructor
 
 	uFile *file;
 	const bool own;
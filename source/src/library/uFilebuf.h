@@ -31,6 +31,8 @@
 #include <iosfwd>					// basic_ios
 #include <streambuf>
 #include <cstdio>					// EOF
+#include <sys/mman.h>					// mmap, madvise, munmap
+#include <sys/stat.h>					// fstat
 
 #include <uFile.h>
 
@@ -67,9 +69,13 @@ namespace std {
 	bool endOfFile;
 	char_type *bufptr;
 	streamsize bufsize;
+	char_type *mapping;				// mapped file, nullptr => buffered
+	size_t mapsize;					// bytes mapped
 
 	static int IosToUnixMode( ios_base::openmode mode );
 	static int char_tarToUnixMode( const char *mode );
+	void map();
+	void unmap();
       protected:
 	uOwnerLock ownerlock;
 
@@ -83,6 +89,10 @@ namespace std {
 	int pbackfail( int_type c = EOF );
 	void imbue( const locale & );
       public:
+	// non-standard open mode: map a regular input file into memory, so the get area spans the whole file and reading
+	// makes no copies or system calls; the file is read as it was when opened. Other files are read through the buffer.
+	static const ios_base::openmode mapped = ios_base::openmode( 1L << 14 );
+
 	basic_filebuf();
 	basic_filebuf( int fd, int bufsize = __U_BUFFER_SIZE__ );
 	basic_filebuf( int fd, char *buf, int bufsize );
@@ -93,9 +103,14 @@ namespace std {
 	basic_filebuf *close();
 
 	int fd();
+	bool is_mapped() const;
     }; // basic_filebuf
 
 
+    template< typename char_t, typename traits >
+    const ios_base::openmode basic_filebuf<char_t, traits>::mapped;
+
+
     template< typename char_t, typename traits >
     int basic_filebuf<char_t, traits>::IosToUnixMode( ios_base::openmode mode ) {
 	int m;
@@ -155,6 +170,7 @@ namespace std {
     basic_filebuf<char_t, traits>::basic_filebuf() {
 	ufile = nullptr;
 	ufileacc = nullptr;
+	mapping = nullptr;
 	setbuf( buffer, __U_BUFFER_SIZE__ );		// reset all buffer pointers
 	endOfFile = false;
     } // basic_filebuf<char_t, traits>::basic_filebuf
@@ -166,6 +182,7 @@ namespace std {
 	ufile = new uFile( "/dev/tty" );
 	ufileacc = new uFile::FileAccess( fd, *ufile );
 	assert( bufsize <= __U_BUFFER_SIZE__ );
+	mapping = nullptr;
 	setbuf( buffer, bufsize );			// reset all buffer pointers
 	endOfFile = false;
     } // basic_filebuf<char_t, traits>::basic_filebuf
@@ -176,6 +193,7 @@ namespace std {
     basic_filebuf<char_t, traits>::basic_filebuf( int fd, char *buf, int bufsize ) {
 	ufile = new uFile( "unknown" );
 	ufileacc = new uFile::FileAccess( fd, *ufile );
+	mapping = nullptr;
 	setbuf( buf, bufsize );				// reset all buffer pointers
 	endOfFile = false;
     } // basic_filebuf<char_t, traits>::basic_filebuf
@@ -199,8 +217,16 @@ namespace std {
     template< typename char_t, typename traits >
     basic_filebuf<char_t, traits> *basic_filebuf<char_t, traits>::open( const char *filename, ios_base::openmode mode ) {
 	if ( is_open() ) return nullptr;
+	bool map = mode & mapped;
+	if ( map ) {
+	    if ( mode & (ios_base::out | ios_base::app | ios_base::trunc) ) {
+		abort( "basic_filebuf::open( %s ) : mapped mode is input only.", filename );
+	    } // if
+	    mode &= ~mapped;
+	} // if
 	ufile = new uFile( filename );
 	ufileacc = new uFile::FileAccess( *ufile, IosToUnixMode( mode ) );
+	if ( map ) this->map();
 	if ( mode & ios_base::ate ) {			// seek to the end of the file
 	    if ( seekoff( 0, ios_base::end ) == pos_type( off_type( -1 ) ) ) {
 		close();
@@ -220,6 +246,7 @@ namespace std {
 		ret = nullptr;
 	    } // if
 	} // if
+	unmap();
 	if ( is_open() ) {
 	    try {
 		delete ufileacc;
@@ -244,12 +271,52 @@ namespace std {
     } // basic_filebuf<char_t, traits>::fd
 
 
+// non-standard
+    template< typename char_t, typename traits >
+    bool basic_filebuf<char_t, traits>::is_mapped() const {
+	return mapping != nullptr;
+    } // basic_filebuf<char_t, traits>::is_mapped
+
+
+    template< typename char_t, typename traits >
+    void basic_filebuf<char_t, traits>::map() {
+	struct stat buf;
+	int fd = ufileacc->access.fd;
+	if ( fstat( fd, &buf ) == -1 || ! S_ISREG( buf.st_mode ) || buf.st_size < (off_t)sizeof(char_type) ) return; // buffered
+	void *addr = mmap( nullptr, buf.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+      if ( addr == MAP_FAILED ) return;			// buffered
+	// Sequential access doubles the kernel readahead window and frees pages behind the reader; WILLNEED starts
+	// asynchronous readahead now rather than on the first page fault.
+	madvise( addr, buf.st_size, MADV_SEQUENTIAL );
+	madvise( addr, buf.st_size, MADV_WILLNEED );
+	mapping = (char_type *)addr;
+	mapsize = buf.st_size;
+	setg( mapping, mapping, mapping + mapsize / sizeof(char_type) ); // get area is the file
+	setp( nullptr, nullptr );			// no output
+	endOfFile = true;				// no reads
+    } // basic_filebuf<char_t, traits>::map
+
+
+    template< typename char_t, typename traits >
+    void basic_filebuf<char_t, traits>::unmap() {
+      if ( mapping == nullptr ) return;
+	munmap( mapping, mapsize );
+	mapping = nullptr;
+	setg( bufptr, bufptr, bufptr );			// reset input buffer pointers
+	setp( bufptr, bufptr + bufsize - 1 );		// reset output buffer pointers
+	endOfFile = false;
+    } // basic_filebuf<char_t, traits>::unmap
+
+
 // 27.8.1.4 Overridden virtual functions
 
 
     template< typename char_t, typename traits >
     typename basic_filebuf<char_t, traits>::int_type basic_filebuf<char_t, traits>::underflow() {
 	if ( ! is_open() ) return traits::eof();	// file open ?
+	if ( mapping != nullptr ) {			// whole file in get area
+	    return gptr() < egptr() ? traits::to_int_type( *gptr() ) : traits::eof();
+	} // if
 
 	int rbytes;
 	int_type c = traits::eof();			// initialized to silence warning
@@ -313,6 +380,7 @@ namespace std {
     basic_filebuf<char_t, traits> *basic_filebuf<char_t, traits>::setbuf( char_type *buf, streamsize size ) {
 	// It is necessary to have at least one character of storage to hold the last character read by underflow.
 	// Having one character also simplifies the implementation of overflow.
+      if ( mapping != nullptr ) return this;		// mapped file is the buffer
 	if ( buf == nullptr || size == 0 ) {
 	    bufptr = buffer;
 	    bufsize = 1;
@@ -332,6 +400,14 @@ namespace std {
 	if ( ! is_open() ) return traits::eof();	// file open ?
 	off_t pos;
 
+	if ( mapping != nullptr ) {			// move within get area
+	    off_t end = egptr() - eback();
+	    pos = dir == ios_base::beg ? off : dir == ios_base::cur ? gptr() - eback() + off : end + off;
+	  if ( pos < 0 || pos > end ) return pos_type( off_type( -1 ) );
+	    setg( eback(), eback() + pos, egptr() );
+	    return pos_type( off_type( pos ) );
+	} // if
+
 	sync();						// empty output buffer
 	endOfFile = false;
 	if ( dir == ios_base::beg ) {
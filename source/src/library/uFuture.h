@@ -440,56 +440,78 @@ UPP::BinarySelector< UPP::UnarySelector< Future_ISM< Future > >, UPP::BinarySele
 //############################## uWaitQueue_ISM ##############################
 
 
+// Each element registers with its future once, when added. A delivered future puts its element on the ready list, so
+// drop takes the first ready element and unregisters only that element, instead of registering and unregistering every
+// element on each call. The ready list is shared with delivering tasks; the rest of the queue belongs to the dropper.
+// An element stays registered until it is dropped or removed, so a future must not be reset while it is in a wait
+// queue; hence, each element is signalled and put on the ready list at most once.
+
 template< typename Selectee >
 class uWaitQueue_ISM {
-    struct DL;
-
-    struct DropClient {
-	UPP::uSemaphore sem; 				// selection client waits if no future available
-	unsigned int tst;				// test-and-set for server race
-	DL * winner;					// indicate winner of race
-
-	DropClient() : sem( 0 ), tst( 0 ) {};
-    }; // DropClient
-
     struct DL : public uSeqable {
 	struct uBaseFutureDL : public UPP::BaseFutureDL {
-	    DropClient * client;			// client data for server
 	    DL * s;					// iterator corresponding to this DL
 
 	    uBaseFutureDL( DL * t ) : s( t ) {}
 
-	    virtual void signal() {
-		if ( uTestSet( client->tst ) == 0 ) {	// returns 0 or non-zero
-		    client->winner = s;
-		    client->sem.V();			// client see changes because semaphore does memory barriers
-		} // if
+	    virtual void signal() {			// called by delivering task
+		s->queue->ready( s );
 	    } // signal
 	}; // uBaseFutureDL
 
 	uBaseFutureDL selectState;
 	Selectee selectee;
+	uWaitQueue_ISM * queue;
+	DL * nextReady;					// link on ready list
+	bool registered;				// on future's select list
+	bool listed;					// on ready list
 
-	DL( Selectee t ) : selectState( this ), selectee( t ) {}
+	DL( Selectee t, uWaitQueue_ISM * queue ) : selectState( this ), selectee( t ), queue( queue ), nextReady( nullptr ), registered( false ), listed( false ) {}
     }; // DL
 
     uSequence< DL > q;
+    uOwnerLock lock;					// protects ready list
+    uCondLock delivered;
+    DL * head, * tail;					// ready list, FIFO
+
+    void ready( DL * t ) {
+	lock.acquire();
+	t->listed = true;
+	t->nextReady = nullptr;
+	if ( head == nullptr ) head = t;
+	else tail->nextReady = t;
+	tail = t;
+	delivered.signal();
+	lock.release();
+    } // uWaitQueue_ISM::ready
+
+    void unlink( DL * t ) {				// unregister and take off ready list
+	if ( t->registered ) t->selectee.removeSelect( &t->selectState ); // no signal after this
+	lock.acquire();
+	if ( t->listed ) {
+	    DL * prev = nullptr;
+	    for ( DL * r = head; r != t; prev = r, r = r->nextReady );
+	    if ( prev == nullptr ) head = t->nextReady;
+	    else prev->nextReady = t->nextReady;
+	    if ( tail == t ) tail = prev;
+	} // if
+	lock.release();
+	q.remove( t );
+	delete t;
+    } // uWaitQueue_ISM::unlink
   public:
     uWaitQueue_ISM( const uWaitQueue_ISM & ) = delete;	// no copy
     uWaitQueue_ISM( uWaitQueue_ISM && ) = delete;
     uWaitQueue_ISM &operator=( const uWaitQueue_ISM & ) = delete; // no assignment
 
-    uWaitQueue_ISM() {}
+    uWaitQueue_ISM() : head( nullptr ), tail( nullptr ) {}
 
-    template< typename Iterator > uWaitQueue_ISM( Iterator begin, Iterator end ) {
+    template< typename Iterator > uWaitQueue_ISM( Iterator begin, Iterator end ) : head( nullptr ), tail( nullptr ) {
 	add( begin, end );
     } // uWaitQueue_ISM::uWaitQueue_ISM
 
     ~uWaitQueue_ISM() {
-	DL * t;
-	for ( uSeqIter< DL > i( q ); i >> t; ) {
-	    delete t;
-	} // for
+	while ( ! q.empty() ) unlink( q.head() );
     } // uWaitQueue_ISM::~uWaitQueue_ISM
 
     bool empty() const {
@@ -497,7 +519,13 @@ class uWaitQueue_ISM {
     } // uWaitQueue_ISM::empty
 
     void add( Selectee n ) {
-	q.add( new DL( n ) );
+	DL * t = new DL( n, this );
+	q.add( t );
+	t->registered = true;				// set before delivery can signal
+	if ( t->selectee.addSelect( &t->selectState ) ) { // already available => not registered
+	    t->registered = false;
+	    ready( t );
+	} // if
     } // uWaitQueue_ISM::add
 
     template< typename Iterator > void add( Iterator begin, Iterator end ) {
@@ -510,8 +538,7 @@ class uWaitQueue_ISM {
 	DL * t = 0;
 	for ( uSeqIter< DL > i( q ); i >> t; ) {
 	    if ( t->selectee.equals( n ) ) {
-		q.remove( t );
-		delete t;
+		unlink( t );
 	    } // if
 	} // for
     } // uWaitQueue_ISM::remove
@@ -519,30 +546,12 @@ class uWaitQueue_ISM {
     Selectee drop() {
 	if ( q.empty() ) abort( "uWaitQueue_ISM: attempt to drop from an empty queue" );
 
-	DropClient client;
-	DL * t = 0;
-	for ( uSeqIter< DL > i( q ); i >> t; ) {
-	    t->selectState.client = &client;
-	    if ( t->selectee.addSelect( &t->selectState ) ) {
-		DL * s;
-		for ( uSeqIter< DL > j( q ); j >> s && s != t; ) {
-		    s->selectee.removeSelect( &s->selectState );
-		} // for
-		goto cleanup;
-	    } // if
-	} // for
-
-	client.sem.P();
-	t = client.winner;
-	DL * s;
-	for ( uSeqIter< DL > i( q ); i >> s; ) {
-	    s->selectee.removeSelect( &s->selectState );
-	} // for
-
-      cleanup:
+	lock.acquire();
+	while ( head == nullptr ) delivered.wait( lock );
+	DL * t = head;					// unlink is O(1) for the head
+	lock.release();
 	Selectee selectee = t->selectee;
-	q.remove( t );
-	delete t;
+	unlink( t );
 	return selectee;
     } // uWaitQueue_ISM::drop
 
@@ -665,6 +674,10 @@ class uExecutor {
 	  if ( next_ ) { tail = next_; return tail_; }
 	    return nullptr;
 	} // Buffer::remove
+
+	ELEMTYPE * steal() {				// single consumer => no stealing
+	    return nullptr;
+	} // Buffer::steal
     }; // Buffer
 
 #elif defined( SPINLOCK )
@@ -686,6 +699,13 @@ class uExecutor {
 	    mutex.release();
 	    return ret;
 	} // Buffer::remove
+
+	ELEMTYPE * steal() {				// remove by other worker, never a stop request
+	    mutex.acquire();
+	    ELEMTYPE * ret = buf.empty() || buf.head()->stop() ? nullptr : buf.dropHead();
+	    mutex.release();
+	    return ret;
+	} // Buffer::steal
     }; // Buffer
 
 #else // monitor
@@ -705,6 +725,11 @@ class uExecutor {
 	    if ( buf.empty() ) return nullptr;		// no request to process ? => 
 	    return buf.dropHead();
 	} // Buffer::remove
+
+	ELEMTYPE * steal() {				// remove by other worker, never a stop request
+	    if ( buf.empty() || buf.head()->stop() ) return nullptr;
+	    return buf.dropHead();
+	} // Buffer::steal
     }; // Buffer
 
 #endif // LOCKTYPE
@@ -731,14 +756,33 @@ class uExecutor {
     }; // FRequest
 
     // Each worker has its own set (when requests buffers > workers) of work buffers to reduce contention between client
-    // and server, where work requests arrive and are distributed into buffers in a roughly round-robin order.
+    // and server, where work requests arrive and are distributed into buffers in a roughly round-robin order. A worker
+    // finding all its buffers empty steals one request from another worker's buffer, trying one victim per pass so an
+    // idle worker does not contend on every buffer. Requests have no ordering across buffers, and an actor mailbox is
+    // queued at most once, so stealing preserves per-actor FIFO order.
     template< typename ELEMTYPE > _Task Thread {
 	Buffer< ELEMTYPE > * requests;
-	unsigned int start, range;
+	unsigned int start, range, nrqueues, victim;
+
+	ELEMTYPE * steal() {
+	  if ( range == nrqueues ) return nullptr;	// no other buffers
+	    victim = (victim + 1) % nrqueues;
+	    if ( victim == start ) victim = (start + range) % nrqueues; // skip own buffers
+	    return requests[victim].steal();
+	} // Thread::steal
 
 	void main() {
-	    for ( int i = 0;; i = (i + 1) % range ) {	// cycle through set of requests buffers
+	    for ( unsigned int i = 0, empty = 0;; i = (i + 1) % range ) { // cycle through set of requests buffers
 		ELEMTYPE * request = requests[i + start].remove();
+		if ( request ) {
+		    empty = 0;
+		} else {
+		    empty += 1;
+		    if ( empty >= range ) {		// all own buffers empty ?
+			empty = 0;
+			request = steal();
+		    } // if
+		} // if
 	      if ( ! request ) {
 		    #if ! defined( __U_MULTI__ )
 		    uThisTask().uYieldNoPoll();
@@ -751,8 +795,8 @@ class uExecutor {
 	    } // for
 	} // Thread::main
       public:
-	Thread( uCluster & wc, Buffer< ELEMTYPE > * requests, unsigned int start, unsigned int range ) :
-	    uBaseTask( wc ), requests( requests ), start( start ), range( range ) {}
+	Thread( uCluster & wc, Buffer< ELEMTYPE > * requests, unsigned int start, unsigned int range, unsigned int nrqueues ) :
+	    uBaseTask( wc ), requests( requests ), start( start ), range( range ), nrqueues( nrqueues ), victim( start + range - 1 ) {}
     }; // Thread
 
     uCluster * cluster;					// if workers execute on separate cluster
@@ -799,7 +843,7 @@ class uExecutor {
 
 	unsigned int reqPerThread = nrqueues / nthreads, extras = nrqueues % nthreads;
 	for ( unsigned int i = 0, step = 0; i < nthreads; i += 1, step += reqPerThread + ( i < extras ? 1 : 0 ) ) {
-	    workers[ i ] = new Thread< WRequest >( *cluster, requests, step, reqPerThread + ( i < extras ? 1 : 0 ) );
+	    workers[ i ] = new Thread< WRequest >( *cluster, requests, step, reqPerThread + ( i < extras ? 1 : 0 ), nrqueues );
 	} // for
     } // uExecutor::uExecutor
 
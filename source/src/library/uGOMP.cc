@@ -0,0 +1,1014 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// uGOMP.cc -- GNU OpenMP runtime entry points implemented with uC++ tasks, so OpenMP parallel regions execute on the
+//     processors of the calling task's cluster instead of a separate kernel-thread pool.
+//
+// Author           :
+// Created On       : Sun Oct 18 20:26:48 2026
+// Last Modified By :
+// Last Modified On : Sun Oct 18 20:26:48 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+
+#define __U_KERNEL__
+#include <uC++.h>
+#include <cstdint>					// uintptr_t
+#include <climits>					// LONG_MAX
+#include <cstdio>					// fprintf
+#include <cstdlib>					// getenv, strtol
+#include <cstring>					// strchr
+#include <strings.h>					// strcasecmp, strncasecmp
+#include <pthread.h>
+
+//#include <uDebug.h>
+
+
+// Linked ahead of libgomp by "u++ -openmp", so gcc's outlined OpenMP code calls these routines. A team is the calling
+// task plus worker tasks created on the calling task's cluster, so team members are multiplexed on the cluster's
+// processors with the program's other tasks and the processor count, not the team size, bounds the kernel threads.
+// Worker creation reuses the processor task and stack caches. Team-member state is kept in per-task pthread-specific
+// data. Explicit tasks execute immediately (undeferred), which is always a conforming schedule.
+//
+// Not provided: ordered, doacross, task dependences and detach, task reductions, teams and target constructs, and
+// unsigned long long loops of more than LONG_MAX iterations. Every GOMP_ entry point generated by gcc without an
+// implementation is defined to abort with its name, because binding to libgomp's version would run outside any uC++
+// team. Cancellation is accepted and ignored, as when OMP_CANCELLATION is false.
+
+namespace UPP {
+    enum GOMPSchedule { Runtime = 0, Static = 1, Dynamic = 2, Guided = 3, Auto = 4 }; // gcc's gomp_schedule_type
+    enum { MonotonicFlag = 0x80000000 };		// high bit of schedule passed to GOMP_loop_start
+    enum { TaskDepend = 1 << 3, TaskUp = 1 << 8, TaskReduction = 1 << 12, TaskDetach = 1 << 13 }; // GOMP_TASK_FLAG_*
+
+    struct GOMPWorkShare {				// state shared by a team for one loop, sections or single construct
+	unsigned long int seq;				// construct number occupying slot
+	unsigned int done;				// members that left construct
+	bool used;
+	int sched;
+	long start, end, incr, chunk;
+	volatile long next;				// next unassigned iteration for dynamic and guided
+	void *copy;					// copyprivate data
+    }; // GOMPWorkShare
+
+
+    class GOMPTeam {
+	friend struct GOMPMember;			// access: ws
+      public:
+	enum { Slots = 8 };				// work shares in progress, members started at most Slots - 1 ahead
+	void (*fn)( void * );
+	void *data;
+	const unsigned int size, level;
+      private:
+	uOwnerLock lock;
+	uCondLock barrierCond, slotCond;
+	unsigned int arrived;
+	unsigned long int generation;
+	GOMPWorkShare ws[Slots];
+      public:
+	GOMPTeam( void (*fn)( void * ), void *data, unsigned int size, unsigned int level ) : fn( fn ), data( data ), size( size ), level( level ) {
+	    arrived = 0;
+	    generation = 0;
+	    for ( unsigned int i = 0; i < Slots; i += 1 ) ws[i].used = false;
+	} // GOMPTeam::GOMPTeam
+
+	void barrier() {
+	  if ( size == 1 ) return;
+	    lock.acquire();
+	    unsigned long int gen = generation;
+	    arrived += 1;
+	    if ( arrived == size ) {			// last arrival releases team
+		arrived = 0;
+		generation += 1;
+		barrierCond.broadcast();
+	    } else {
+		while ( gen == generation ) barrierCond.wait( lock );
+	    } // if
+	    lock.release();
+	} // GOMPTeam::barrier
+
+	// The first member to reach construct seq initializes its slot from init; later members use it. A member more
+	// than Slots constructs ahead waits until the slot's previous construct is finished by every member.
+
+	GOMPWorkShare *enter( unsigned long int seq, const GOMPWorkShare &init, bool &first ) {
+	    GOMPWorkShare &w = ws[seq % Slots];
+	    lock.acquire();
+	    for ( ;; ) {
+		if ( w.used && w.seq == seq ) {
+		    first = false;
+		    break;
+		} // if
+		if ( ! w.used ) {
+		    w = init;
+		    w.used = true;
+		    w.seq = seq;
+		    w.done = 0;
+		    w.next = init.start;
+		    first = true;
+		    break;
+		} // if
+		slotCond.wait( lock );
+	    } // for
+	    lock.release();
+	    return &w;
+	} // GOMPTeam::enter
+
+	void leave( GOMPWorkShare *w ) {
+	    lock.acquire();
+	    w->done += 1;
+	    if ( w->done == size ) {			// last member frees slot
+		w->used = false;
+		slotCond.broadcast();
+	    } // if
+	    lock.release();
+	} // GOMPTeam::leave
+    }; // GOMPTeam
+
+
+    struct GOMPRegion;
+
+    struct GOMPMember {					// per-task state, found through pthread-specific data
+	GOMPTeam *team;
+	GOMPRegion *region;				// master's region, for GOMP_parallel_end
+	unsigned int id;				// omp_get_thread_num
+	unsigned long int seq;				// next construct
+	GOMPWorkShare *ws;				// current work share
+	long staticNext;				// chunks of static schedule taken by this member
+	unsigned long long ullStart, ullIncr;		// unsigned long long loop mapped onto iteration numbers
+	GOMPMember *outer;				// enclosing region's state, nullptr for sequential state
+
+	GOMPMember( GOMPTeam *team, unsigned int id, GOMPMember *outer ) :
+	    team( team ), region( nullptr ), id( id ), seq( 0 ), ws( nullptr ), staticNext( 0 ), outer( outer ) {}
+
+	// Combined parallel-loop and parallel-sections entry points start the team inside its first work share.
+
+	void preset() {
+	    ws = &team->ws[0];
+	    seq = 1;
+	} // GOMPMember::preset
+    }; // GOMPMember
+
+
+    _Task GOMPWorker {
+	GOMPTeam &team;
+	unsigned int id;
+	GOMPMember *outer;				// master's enclosing state, for nesting level
+	bool preset;
+
+	void main();
+      public:
+	GOMPWorker( GOMPTeam &team, unsigned int id, GOMPMember *outer, bool preset ) :
+	    uBaseTask( uThisCluster() ), team( team ), id( id ), outer( outer ), preset( preset ) {}
+    }; // GOMPWorker
+
+
+    struct GOMPRegion {					// GOMP_parallel_start state, popped by GOMP_parallel_end
+	GOMPTeam team;
+	GOMPMember master;
+	GOMPWorker **workers;
+
+	GOMPRegion( void (*fn)( void * ), void *data, unsigned int size, GOMPMember *outer ) :
+	    team( fn, data, size, outer->team->level + 1 ), master( &team, 0, outer ) {}
+    }; // GOMPRegion
+
+
+    // Internal control variables are global rather than per task.
+
+    static unsigned int nthreadsVar = 0;		// 0 => processors on calling task's cluster
+    static bool nestedVar = false, dynamicVar = false;
+    static unsigned int maxActiveLevelsVar = 1;
+    static int runSched = Dynamic;			// OMP_SCHEDULE, read once
+    static long runChunk = 1;
+
+    static pthread_key_t memberKey;
+    static pthread_once_t memberOnce = PTHREAD_ONCE_INIT;
+    static uOwnerLock criticalLock, atomicLock;
+
+
+    static void freeMember( void *m ) {			// sequential member of a finished task
+	GOMPMember *member = (GOMPMember *)m;
+	if ( member->outer == nullptr ) {
+	    delete member->team;
+	    delete member;
+	} // if
+    } // freeMember
+
+    static void initialize() {
+	pthread_key_create( &memberKey, freeMember );
+	if ( getenv( "OMP_NUM_THREADS" ) != nullptr ) nthreadsVar = atoi( getenv( "OMP_NUM_THREADS" ) );
+	if ( getenv( "OMP_NESTED" ) != nullptr && strcasecmp( getenv( "OMP_NESTED" ), "true" ) == 0 ) {
+	    nestedVar = true;
+	    maxActiveLevelsVar = ~0u;
+	} // if
+	const char *sched = getenv( "OMP_SCHEDULE" );
+	if ( sched != nullptr ) {
+	    if ( strncasecmp( sched, "static", 6 ) == 0 ) { runSched = Static; runChunk = 0; }
+	    else if ( strncasecmp( sched, "guided", 6 ) == 0 ) runSched = Guided;
+	    else if ( strncasecmp( sched, "auto", 4 ) == 0 ) { runSched = Static; runChunk = 0; }
+	    const char *comma = strchr( sched, ',' );
+	    if ( comma != nullptr ) runChunk = strtol( comma + 1, nullptr, 10 );
+	} // if
+    } // initialize
+
+    static GOMPMember &self() {				// state of calling task, sequential team if not in a region
+	pthread_once( &memberOnce, initialize );
+	GOMPMember *member = (GOMPMember *)pthread_getspecific( memberKey );
+	if ( member == nullptr ) {
+	    member = new GOMPMember( new GOMPTeam( nullptr, nullptr, 1, 0 ), 0, nullptr );
+	    pthread_setspecific( memberKey, member );
+	} // if
+	return *member;
+    } // self
+
+    static unsigned int activeLevels( GOMPMember &m ) {
+	unsigned int levels = 0;
+	for ( GOMPMember *p = &m; p != nullptr; p = p->outer ) {
+	    if ( p->team->size > 1 ) levels += 1;
+	} // for
+	return levels;
+    } // activeLevels
+
+    static unsigned int teamSize( GOMPMember &outer, unsigned int requested ) {
+      if ( activeLevels( outer ) >= maxActiveLevelsVar ) return 1; // nested region serialized
+	unsigned int size = requested != 0 ? requested : nthreadsVar != 0 ? nthreadsVar : uThisCluster().getProcessors();
+	return size == 0 ? 1 : size;
+    } // teamSize
+
+
+    void GOMPWorker::main() {
+	GOMPMember member( &team, id, outer );
+	if ( preset ) member.preset();
+	pthread_once( &memberOnce, initialize );
+	pthread_setspecific( memberKey, &member );
+	team.fn( team.data );
+	pthread_setspecific( memberKey, nullptr );	// member is not sequential state
+    } // GOMPWorker::main
+
+
+    static GOMPRegion *begin( void (*fn)( void * ), void *data, unsigned int requested, const GOMPWorkShare *first ) {
+	GOMPMember &outer = self();
+	GOMPRegion *region = new GOMPRegion( fn, data, teamSize( outer, requested ), &outer );
+	if ( first != nullptr ) {			// combined construct, start inside first work share
+	    bool unused;
+	    region->team.enter( 0, *first, unused );
+	    region->master.preset();
+	} // if
+	region->workers = new GOMPWorker *[region->team.size];
+	for ( unsigned int i = 1; i < region->team.size; i += 1 ) {
+	    region->workers[i] = new GOMPWorker( region->team, i, &outer, first != nullptr );
+	} // for
+	region->master.region = region;
+	pthread_setspecific( memberKey, &region->master );
+	return region;
+    } // begin
+
+    static void end( GOMPRegion *region ) {
+	pthread_setspecific( memberKey, region->master.outer );
+	for ( unsigned int i = 1; i < region->team.size; i += 1 ) {
+	    delete region->workers[i];			// join
+	} // for
+	delete [] region->workers;
+	delete region;
+    } // end
+
+    static void parallel( void (*fn)( void * ), void *data, unsigned int requested, const GOMPWorkShare *first ) {
+	GOMPRegion *region = begin( fn, data, requested, first );
+	fn( data );
+	end( region );
+    } // parallel
+
+
+    //######################### loops #########################
+
+
+    static GOMPWorkShare loopInit( long sched, long start, long end, long incr, long chunk ) {
+	GOMPWorkShare init;
+	sched &= ~(long)MonotonicFlag;
+	if ( sched == Runtime ) {
+	    sched = runSched;
+	    chunk = runChunk;
+	} else if ( sched == Auto ) {
+	    sched = Static;
+	    chunk = 0;
+	} // if
+	if ( sched != Static && chunk < 1 ) chunk = 1;
+	init.sched = sched;
+	init.start = start;
+	init.end = end;
+	init.incr = incr;
+	init.chunk = chunk;
+	init.copy = nullptr;
+	return init;
+    } // loopInit
+
+    static bool loopNext( long *istart, long *iend ) {
+	GOMPMember &m = self();
+	GOMPWorkShare &w = *m.ws;
+	long s, e;
+	switch ( w.sched ) {
+	  case Static: {
+	    long n = w.incr > 0 ? (w.end - w.start + w.incr - 1) / w.incr : (w.start - w.end - w.incr - 1) / -w.incr; // iterations
+	    if ( n <= 0 ) return false;
+	    long size = m.team->size, first, count;
+	    if ( w.chunk == 0 ) {			// one contiguous block per member
+		if ( m.staticNext != 0 ) return false;
+		long q = n / size, r = n % size;
+		first = m.id * q + ( (long)m.id < r ? m.id : r );
+		count = q + ( (long)m.id < r ? 1 : 0 );
+	    } else {					// round-robin chunks
+		first = ( m.staticNext * size + m.id ) * w.chunk;
+		count = w.chunk;
+	    } // if
+	    if ( first >= n || count == 0 ) return false;
+	    if ( first + count > n ) count = n - first;
+	    m.staticNext += 1;
+	    s = w.start + first * w.incr;
+	    e = s + count * w.incr;
+	    break;
+	  }
+	  case Guided:
+	    for ( ;; ) {
+		s = w.next;
+		long n = w.incr > 0 ? (w.end - s + w.incr - 1) / w.incr : (s - w.end - w.incr - 1) / -w.incr;
+	      if ( n <= 0 ) return false;
+		long q = (n + m.team->size - 1) / m.team->size; // remaining divided among members
+		if ( q < w.chunk ) q = w.chunk;
+		if ( q > n ) q = n;
+		e = s + q * w.incr;
+	      if ( __atomic_compare_exchange_n( &w.next, &s, e, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED ) ) break;
+	    } // for
+	    break;
+	  default:					// Dynamic
+	    s = __atomic_fetch_add( &w.next, w.chunk * w.incr, __ATOMIC_RELAXED );
+	    if ( w.incr > 0 ? s >= w.end : s <= w.end ) return false;
+	    e = s + w.chunk * w.incr;
+	    if ( w.incr > 0 ? e > w.end : e < w.end ) e = w.end;
+	    break;
+	} // switch
+	*istart = s;
+	*iend = e;
+	return true;
+    } // loopNext
+
+    static bool loopStart( long sched, long start, long end, long incr, long chunk, long *istart, long *iend ) {
+	GOMPMember &m = self();
+	bool first;
+	m.ws = m.team->enter( m.seq, loopInit( sched, start, end, incr, chunk ), first );
+	m.seq += 1;
+	m.staticNext = 0;
+	return istart == nullptr ? false : loopNext( istart, iend );
+    } // loopStart
+
+    static void workShareEnd( bool wait ) {
+	GOMPMember &m = self();
+	m.team->leave( m.ws );
+	m.ws = nullptr;
+	if ( wait ) m.team->barrier();
+    } // workShareEnd
+
+    static void unsupported( const char *name, const char *entry = __builtin_FUNCTION() ) {
+	abort( "OpenMP %s (%s) is not supported by the uC++ OpenMP runtime.", name, entry );
+    } // unsupported
+
+    // A taskloop is one undeferred task for the whole iteration space, which is a conforming partitioning when the
+    // grainsize or num_tasks clause is not strict. The task finds its bounds in the first two words of its data.
+
+    template< typename T > static void taskloop( void (*fn)( void * ), void *data, void (*cpyfn)( void *, void * ), long arg_size, long arg_align,
+						  unsigned int flags, T start, T end ) {
+	if ( flags & TaskReduction ) unsupported( "taskloop reductions" );
+      if ( flags & TaskUp ? start >= end : start <= end ) return; // no iterations
+	char buf[arg_size + arg_align - 1];
+	char *arg = (char *)(((uintptr_t)buf + arg_align - 1) & ~(uintptr_t)(arg_align - 1));
+	if ( cpyfn == nullptr ) {
+	    memcpy( arg, data, arg_size );
+	} else {
+	    cpyfn( arg, data );				// firstprivate copies
+	} // if
+	((T *)arg)[0] = start;
+	((T *)arg)[1] = end;
+	fn( arg );
+    } // taskloop
+
+    // An unsigned long long loop runs as a long loop over its iteration numbers 0..n-1, which each member maps back to
+    // loop values. A downward loop has a negative increment in two's complement, so the mapping wraps correctly.
+
+    static bool loopUllNext( unsigned long long *istart, unsigned long long *iend ) {
+	GOMPMember &m = self();
+	long s, e;
+      if ( ! loopNext( &s, &e ) ) return false;
+	*istart = m.ullStart + s * m.ullIncr;
+	*iend = m.ullStart + e * m.ullIncr;
+	return true;
+    } // loopUllNext
+
+    static bool loopUllStart( long sched, bool up, unsigned long long start, unsigned long long end, unsigned long long incr,
+			      unsigned long long chunk, unsigned long long *istart, unsigned long long *iend ) {
+	unsigned long long n;				// iterations
+	if ( up ) n = start < end ? (end - start + incr - 1) / incr : 0;
+	else n = start > end ? (start - end - incr - 1) / -incr : 0;
+	if ( n > (unsigned long long)LONG_MAX || chunk > (unsigned long long)LONG_MAX ) {
+	    unsupported( "unsigned long long loops of more than LONG_MAX iterations" );
+	} // if
+	GOMPMember &m = self();
+	m.ullStart = start;
+	m.ullIncr = incr;
+	loopStart( sched, 0, n, 1, chunk, nullptr, nullptr );
+	return istart == nullptr ? false : loopUllNext( istart, iend );
+    } // loopUllStart
+} // UPP
+
+
+using namespace UPP;
+
+extern "C" {
+    //######################### parallel #########################
+
+
+    void GOMP_parallel( void (*fn)( void * ), void *data, unsigned int num_threads, unsigned int ) {
+	parallel( fn, data, num_threads, nullptr );
+    } // GOMP_parallel
+
+    void GOMP_parallel_start( void (*fn)( void * ), void *data, unsigned int num_threads ) {
+	begin( fn, data, num_threads, nullptr );	// master calls fn, then GOMP_parallel_end
+    } // GOMP_parallel_start
+
+    void GOMP_parallel_end() {
+	end( self().region );
+    } // GOMP_parallel_end
+
+    bool GOMP_cancellation_point( int ) { return false; } // cancellation disabled
+    bool GOMP_cancel( int, bool ) { return false; }
+
+
+    //######################### synchronization #########################
+
+
+    void GOMP_barrier() {
+	self().team->barrier();
+    } // GOMP_barrier
+
+    bool GOMP_barrier_cancel() {
+	self().team->barrier();
+	return false;					// cancellation disabled
+    } // GOMP_barrier_cancel
+
+    void GOMP_critical_start() {
+	criticalLock.acquire();
+    } // GOMP_critical_start
+
+    void GOMP_critical_end() {
+	criticalLock.release();
+    } // GOMP_critical_end
+
+    void GOMP_critical_name_start( void **pptr ) {	// pptr is compiler-generated storage for the name
+	uOwnerLock *lock = __atomic_load_n( (uOwnerLock **)pptr, __ATOMIC_ACQUIRE );
+	if ( lock == nullptr ) {
+	    uOwnerLock *fresh = new uOwnerLock;
+	    if ( __atomic_compare_exchange_n( (uOwnerLock **)pptr, &lock, fresh, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE ) ) {
+		lock = fresh;
+	    } else {
+		delete fresh;				// another task installed a lock
+	    } // if
+	} // if
+	lock->acquire();
+    } // GOMP_critical_name_start
+
+    void GOMP_critical_name_end( void **pptr ) {
+	(*(uOwnerLock **)pptr)->release();
+    } // GOMP_critical_name_end
+
+    void GOMP_atomic_start() {
+	atomicLock.acquire();
+    } // GOMP_atomic_start
+
+    void GOMP_atomic_end() {
+	atomicLock.release();
+    } // GOMP_atomic_end
+
+    bool GOMP_single_start() {
+	GOMPMember &m = self();
+	bool first;
+	GOMPWorkShare *w = m.team->enter( m.seq, loopInit( Static, 0, 0, 1, 0 ), first );
+	m.seq += 1;
+	m.team->leave( w );
+	return first;
+    } // GOMP_single_start
+
+    void *GOMP_single_copy_start() {
+	GOMPMember &m = self();
+	bool first;
+	m.ws = m.team->enter( m.seq, loopInit( Static, 0, 0, 1, 0 ), first );
+	m.seq += 1;
+      if ( first ) return nullptr;			// executes single, then GOMP_single_copy_end
+	m.team->barrier();				// wait for copyprivate data
+	void *copy = m.ws->copy;
+	workShareEnd( false );
+	return copy;
+    } // GOMP_single_copy_start
+
+    void GOMP_single_copy_end( void *data ) {
+	GOMPMember &m = self();
+	m.ws->copy = data;
+	m.team->barrier();
+	workShareEnd( false );
+    } // GOMP_single_copy_end
+
+    void GOMP_ordered_start() { unsupported( "ordered" ); }
+    void GOMP_ordered_end() { unsupported( "ordered" ); }
+
+
+    //######################### loops #########################
+
+
+    bool GOMP_loop_static_start( long start, long end, long incr, long chunk, long *istart, long *iend ) {
+	return loopStart( Static, start, end, incr, chunk, istart, iend );
+    } // GOMP_loop_static_start
+
+    bool GOMP_loop_dynamic_start( long start, long end, long incr, long chunk, long *istart, long *iend ) {
+	return loopStart( Dynamic, start, end, incr, chunk, istart, iend );
+    } // GOMP_loop_dynamic_start
+
+    bool GOMP_loop_guided_start( long start, long end, long incr, long chunk, long *istart, long *iend ) {
+	return loopStart( Guided, start, end, incr, chunk, istart, iend );
+    } // GOMP_loop_guided_start
+
+    bool GOMP_loop_runtime_start( long start, long end, long incr, long *istart, long *iend ) {
+	return loopStart( Runtime, start, end, incr, 0, istart, iend );
+    } // GOMP_loop_runtime_start
+
+    bool GOMP_loop_start( long start, long end, long incr, long sched, long chunk, long *istart, long *iend, uintptr_t *reductions, void **mem ) {
+	if ( reductions != nullptr || mem != nullptr ) unsupported( "task reductions in worksharing loops" );
+	return loopStart( sched, start, end, incr, chunk, istart, iend );
+    } // GOMP_loop_start
+
+    bool GOMP_loop_static_next( long *istart, long *iend ) { return loopNext( istart, iend ); }
+    bool GOMP_loop_dynamic_next( long *istart, long *iend ) { return loopNext( istart, iend ); }
+    bool GOMP_loop_guided_next( long *istart, long *iend ) { return loopNext( istart, iend ); }
+    bool GOMP_loop_runtime_next( long *istart, long *iend ) { return loopNext( istart, iend ); }
+
+    // Nonmonotonic schedules may hand out iterations in any order, so the monotonic implementations serve.
+
+    bool GOMP_loop_nonmonotonic_dynamic_start( long start, long end, long incr, long chunk, long *istart, long *iend ) {
+	return loopStart( Dynamic, start, end, incr, chunk, istart, iend );
+    } // GOMP_loop_nonmonotonic_dynamic_start
+
+    bool GOMP_loop_nonmonotonic_guided_start( long start, long end, long incr, long chunk, long *istart, long *iend ) {
+	return loopStart( Guided, start, end, incr, chunk, istart, iend );
+    } // GOMP_loop_nonmonotonic_guided_start
+
+    bool GOMP_loop_nonmonotonic_runtime_start( long start, long end, long incr, long *istart, long *iend ) {
+	return loopStart( Runtime, start, end, incr, 0, istart, iend );
+    } // GOMP_loop_nonmonotonic_runtime_start
+
+    bool GOMP_loop_maybe_nonmonotonic_runtime_start( long start, long end, long incr, long *istart, long *iend ) {
+	return loopStart( Runtime, start, end, incr, 0, istart, iend );
+    } // GOMP_loop_maybe_nonmonotonic_runtime_start
+
+    bool GOMP_loop_nonmonotonic_dynamic_next( long *istart, long *iend ) { return loopNext( istart, iend ); }
+    bool GOMP_loop_nonmonotonic_guided_next( long *istart, long *iend ) { return loopNext( istart, iend ); }
+    bool GOMP_loop_nonmonotonic_runtime_next( long *istart, long *iend ) { return loopNext( istart, iend ); }
+    bool GOMP_loop_maybe_nonmonotonic_runtime_next( long *istart, long *iend ) { return loopNext( istart, iend ); }
+
+    void GOMP_loop_end() {
+	workShareEnd( true );
+    } // GOMP_loop_end
+
+    void GOMP_loop_end_nowait() {
+	workShareEnd( false );
+    } // GOMP_loop_end_nowait
+
+    bool GOMP_loop_end_cancel() {
+	workShareEnd( true );
+	return false;
+    } // GOMP_loop_end_cancel
+
+    typedef unsigned long long ull;
+
+    bool GOMP_loop_ull_static_start( bool up, ull start, ull end, ull incr, ull chunk, ull *istart, ull *iend ) {
+	return loopUllStart( Static, up, start, end, incr, chunk, istart, iend );
+    } // GOMP_loop_ull_static_start
+
+    bool GOMP_loop_ull_dynamic_start( bool up, ull start, ull end, ull incr, ull chunk, ull *istart, ull *iend ) {
+	return loopUllStart( Dynamic, up, start, end, incr, chunk, istart, iend );
+    } // GOMP_loop_ull_dynamic_start
+
+    bool GOMP_loop_ull_guided_start( bool up, ull start, ull end, ull incr, ull chunk, ull *istart, ull *iend ) {
+	return loopUllStart( Guided, up, start, end, incr, chunk, istart, iend );
+    } // GOMP_loop_ull_guided_start
+
+    bool GOMP_loop_ull_runtime_start( bool up, ull start, ull end, ull incr, ull *istart, ull *iend ) {
+	return loopUllStart( Runtime, up, start, end, incr, 0, istart, iend );
+    } // GOMP_loop_ull_runtime_start
+
+    bool GOMP_loop_ull_nonmonotonic_dynamic_start( bool up, ull start, ull end, ull incr, ull chunk, ull *istart, ull *iend ) {
+	return loopUllStart( Dynamic, up, start, end, incr, chunk, istart, iend );
+    } // GOMP_loop_ull_nonmonotonic_dynamic_start
+
+    bool GOMP_loop_ull_nonmonotonic_guided_start( bool up, ull start, ull end, ull incr, ull chunk, ull *istart, ull *iend ) {
+	return loopUllStart( Guided, up, start, end, incr, chunk, istart, iend );
+    } // GOMP_loop_ull_nonmonotonic_guided_start
+
+    bool GOMP_loop_ull_nonmonotonic_runtime_start( bool up, ull start, ull end, ull incr, ull *istart, ull *iend ) {
+	return loopUllStart( Runtime, up, start, end, incr, 0, istart, iend );
+    } // GOMP_loop_ull_nonmonotonic_runtime_start
+
+    bool GOMP_loop_ull_maybe_nonmonotonic_runtime_start( bool up, ull start, ull end, ull incr, ull *istart, ull *iend ) {
+	return loopUllStart( Runtime, up, start, end, incr, 0, istart, iend );
+    } // GOMP_loop_ull_maybe_nonmonotonic_runtime_start
+
+    bool GOMP_loop_ull_start( bool up, ull start, ull end, ull incr, long sched, ull chunk, ull *istart, ull *iend, uintptr_t *reductions, void **mem ) {
+	if ( reductions != nullptr || mem != nullptr ) unsupported( "task reductions in worksharing loops" );
+	return loopUllStart( sched, up, start, end, incr, chunk, istart, iend );
+    } // GOMP_loop_ull_start
+
+    bool GOMP_loop_ull_static_next( ull *istart, ull *iend ) { return loopUllNext( istart, iend ); }
+    bool GOMP_loop_ull_dynamic_next( ull *istart, ull *iend ) { return loopUllNext( istart, iend ); }
+    bool GOMP_loop_ull_guided_next( ull *istart, ull *iend ) { return loopUllNext( istart, iend ); }
+    bool GOMP_loop_ull_runtime_next( ull *istart, ull *iend ) { return loopUllNext( istart, iend ); }
+    bool GOMP_loop_ull_nonmonotonic_dynamic_next( ull *istart, ull *iend ) { return loopUllNext( istart, iend ); }
+    bool GOMP_loop_ull_nonmonotonic_guided_next( ull *istart, ull *iend ) { return loopUllNext( istart, iend ); }
+    bool GOMP_loop_ull_nonmonotonic_runtime_next( ull *istart, ull *iend ) { return loopUllNext( istart, iend ); }
+    bool GOMP_loop_ull_maybe_nonmonotonic_runtime_next( ull *istart, ull *iend ) { return loopUllNext( istart, iend ); }
+
+    // Combined parallel loops: the team starts inside the loop and members call only the next routine.
+
+    static void parallelLoop( void (*fn)( void * ), void *data, unsigned int num_threads, long sched, long start, long end, long incr, long chunk ) {
+	GOMPWorkShare first = loopInit( sched, start, end, incr, chunk );
+	parallel( fn, data, num_threads, &first );
+    } // parallelLoop
+
+    void GOMP_parallel_loop_static( void (*fn)( void * ), void *data, unsigned int num_threads, long start, long end, long incr, long chunk, unsigned int ) {
+	parallelLoop( fn, data, num_threads, Static, start, end, incr, chunk );
+    } // GOMP_parallel_loop_static
+
+    void GOMP_parallel_loop_dynamic( void (*fn)( void * ), void *data, unsigned int num_threads, long start, long end, long incr, long chunk, unsigned int ) {
+	parallelLoop( fn, data, num_threads, Dynamic, start, end, incr, chunk );
+    } // GOMP_parallel_loop_dynamic
+
+    void GOMP_parallel_loop_guided( void (*fn)( void * ), void *data, unsigned int num_threads, long start, long end, long incr, long chunk, unsigned int ) {
+	parallelLoop( fn, data, num_threads, Guided, start, end, incr, chunk );
+    } // GOMP_parallel_loop_guided
+
+    void GOMP_parallel_loop_runtime( void (*fn)( void * ), void *data, unsigned int num_threads, long start, long end, long incr, unsigned int ) {
+	parallelLoop( fn, data, num_threads, Runtime, start, end, incr, 0 );
+    } // GOMP_parallel_loop_runtime
+
+    void GOMP_parallel_loop_nonmonotonic_dynamic( void (*fn)( void * ), void *data, unsigned int num_threads, long start, long end, long incr, long chunk, unsigned int ) {
+	parallelLoop( fn, data, num_threads, Dynamic, start, end, incr, chunk );
+    } // GOMP_parallel_loop_nonmonotonic_dynamic
+
+    void GOMP_parallel_loop_nonmonotonic_guided( void (*fn)( void * ), void *data, unsigned int num_threads, long start, long end, long incr, long chunk, unsigned int ) {
+	parallelLoop( fn, data, num_threads, Guided, start, end, incr, chunk );
+    } // GOMP_parallel_loop_nonmonotonic_guided
+
+    void GOMP_parallel_loop_nonmonotonic_runtime( void (*fn)( void * ), void *data, unsigned int num_threads, long start, long end, long incr, unsigned int ) {
+	parallelLoop( fn, data, num_threads, Runtime, start, end, incr, 0 );
+    } // GOMP_parallel_loop_nonmonotonic_runtime
+
+    void GOMP_parallel_loop_maybe_nonmonotonic_runtime( void (*fn)( void * ), void *data, unsigned int num_threads, long start, long end, long incr, unsigned int ) {
+	parallelLoop( fn, data, num_threads, Runtime, start, end, incr, 0 );
+    } // GOMP_parallel_loop_maybe_nonmonotonic_runtime
+
+    // Pre-gcc 4.9 combined parallel loops: the master calls fn, then GOMP_parallel_end.
+
+    static void parallelLoopStart( void (*fn)( void * ), void *data, unsigned int num_threads, long sched, long start, long end, long incr, long chunk ) {
+	GOMPWorkShare first = loopInit( sched, start, end, incr, chunk );
+	begin( fn, data, num_threads, &first );
+    } // parallelLoopStart
+
+    void GOMP_parallel_loop_static_start( void (*fn)( void * ), void *data, unsigned int num_threads, long start, long end, long incr, long chunk ) {
+	parallelLoopStart( fn, data, num_threads, Static, start, end, incr, chunk );
+    } // GOMP_parallel_loop_static_start
+
+    void GOMP_parallel_loop_dynamic_start( void (*fn)( void * ), void *data, unsigned int num_threads, long start, long end, long incr, long chunk ) {
+	parallelLoopStart( fn, data, num_threads, Dynamic, start, end, incr, chunk );
+    } // GOMP_parallel_loop_dynamic_start
+
+    void GOMP_parallel_loop_guided_start( void (*fn)( void * ), void *data, unsigned int num_threads, long start, long end, long incr, long chunk ) {
+	parallelLoopStart( fn, data, num_threads, Guided, start, end, incr, chunk );
+    } // GOMP_parallel_loop_guided_start
+
+    void GOMP_parallel_loop_runtime_start( void (*fn)( void * ), void *data, unsigned int num_threads, long start, long end, long incr ) {
+	parallelLoopStart( fn, data, num_threads, Runtime, start, end, incr, 0 );
+    } // GOMP_parallel_loop_runtime_start
+
+
+    //######################### sections #########################
+
+
+    // Sections are a dynamic loop over section numbers 1..count with chunk 1; 0 means no more sections.
+
+    static unsigned int sectionNext() {
+	long s, e;
+	return loopNext( &s, &e ) ? s : 0;
+    } // sectionNext
+
+    unsigned int GOMP_sections_start( unsigned int count ) {
+	GOMPMember &m = self();
+	bool first;
+	m.ws = m.team->enter( m.seq, loopInit( Dynamic, 1, count + 1, 1, 1 ), first );
+	m.seq += 1;
+	return sectionNext();
+    } // GOMP_sections_start
+
+    unsigned int GOMP_sections2_start( unsigned int count, uintptr_t *reductions, void **mem ) {
+	if ( reductions != nullptr || mem != nullptr ) unsupported( "task reductions in sections" );
+	return GOMP_sections_start( count );
+    } // GOMP_sections2_start
+
+    unsigned int GOMP_sections_next() {
+	return sectionNext();
+    } // GOMP_sections_next
+
+    void GOMP_sections_end() {
+	workShareEnd( true );
+    } // GOMP_sections_end
+
+    void GOMP_sections_end_nowait() {
+	workShareEnd( false );
+    } // GOMP_sections_end_nowait
+
+    bool GOMP_sections_end_cancel() {
+	workShareEnd( true );
+	return false;
+    } // GOMP_sections_end_cancel
+
+    void GOMP_parallel_sections( void (*fn)( void * ), void *data, unsigned int num_threads, unsigned int count, unsigned int ) {
+	GOMPWorkShare first = loopInit( Dynamic, 1, count + 1, 1, 1 );
+	parallel( fn, data, num_threads, &first );
+    } // GOMP_parallel_sections
+
+    void GOMP_parallel_sections_start( void (*fn)( void * ), void *data, unsigned int num_threads, unsigned int count ) {
+	GOMPWorkShare first = loopInit( Dynamic, 1, count + 1, 1, 1 );
+	begin( fn, data, num_threads, &first );		// master calls fn, then GOMP_parallel_end
+    } // GOMP_parallel_sections_start
+
+    void GOMP_scope_start( uintptr_t *reductions ) {	// generated only for scope with task reductions
+	if ( reductions != nullptr ) unsupported( "task reductions in scope" );
+    } // GOMP_scope_start
+
+
+    //######################### tasks #########################
+
+
+    void GOMP_task( void (*fn)( void * ), void *data, void (*cpyfn)( void *, void * ), long arg_size, long arg_align,
+		    bool, unsigned int flags, void **, int, void * ) {
+	if ( flags & TaskDepend ) unsupported( "task dependences" );
+	if ( flags & TaskDetach ) unsupported( "detached tasks" );
+	if ( cpyfn == nullptr ) {			// execute undeferred
+	    fn( data );
+	} else {
+	    char buf[arg_size + arg_align - 1];		// firstprivate copies
+	    char *arg = (char *)(((uintptr_t)buf + arg_align - 1) & ~(uintptr_t)(arg_align - 1));
+	    cpyfn( arg, data );
+	    fn( arg );
+	} // if
+    } // GOMP_task
+
+    void GOMP_taskloop( void (*fn)( void * ), void *data, void (*cpyfn)( void *, void * ), long arg_size, long arg_align,
+			unsigned int flags, unsigned long, int, long start, long end, long ) {
+	taskloop( fn, data, cpyfn, arg_size, arg_align, flags, start, end );
+    } // GOMP_taskloop
+
+    void GOMP_taskloop_ull( void (*fn)( void * ), void *data, void (*cpyfn)( void *, void * ), long arg_size, long arg_align,
+			    unsigned int flags, unsigned long, int, ull start, ull end, ull ) {
+	taskloop( fn, data, cpyfn, arg_size, arg_align, flags, start, end );
+    } // GOMP_taskloop_ull
+
+    void GOMP_taskwait() {}				// tasks already complete
+    void GOMP_taskgroup_start() {}
+    void GOMP_taskgroup_end() {}
+
+    void GOMP_taskyield() {
+	uBaseTask::yield();
+    } // GOMP_taskyield
+
+
+    //######################### miscellaneous #########################
+
+
+    void *GOMP_alloc( size_t alignment, size_t size, uintptr_t ) { // allocator ignored
+	return memalign( alignment, size );
+    } // GOMP_alloc
+
+    void GOMP_free( void *ptr, uintptr_t ) {
+	free( ptr );
+    } // GOMP_free
+
+    void GOMP_warning( const char *msg, size_t len ) {	// error directive with severity( warning )
+	if ( msg == nullptr ) fprintf( stderr, "libgomp: error directive encountered\n" );
+	else fprintf( stderr, "libgomp: %.*s\n", (int)len, msg );
+    } // GOMP_warning
+
+    void GOMP_error( const char *msg, size_t len ) {
+	if ( msg == nullptr ) abort( "OpenMP fatal error directive encountered." );
+	abort( "OpenMP fatal error: %.*s", (int)len, msg );
+    } // GOMP_error
+
+
+    //######################### not supported #########################
+
+
+    #define __U_GOMP_UNSUPPORTED__( name, feature ) void name() { unsupported( feature ); }
+
+    __U_GOMP_UNSUPPORTED__( GOMP_loop_ordered_static_start, "ordered" )
+    __U_GOMP_UNSUPPORTED__( GOMP_loop_ordered_dynamic_start, "ordered" )
+    __U_GOMP_UNSUPPORTED__( GOMP_loop_ordered_guided_start, "ordered" )
+    __U_GOMP_UNSUPPORTED__( GOMP_loop_ordered_runtime_start, "ordered" )
+    __U_GOMP_UNSUPPORTED__( GOMP_loop_ordered_start, "ordered" )
+    __U_GOMP_UNSUPPORTED__( GOMP_loop_ordered_static_next, "ordered" )
+    __U_GOMP_UNSUPPORTED__( GOMP_loop_ordered_dynamic_next, "ordered" )
+    __U_GOMP_UNSUPPORTED__( GOMP_loop_ordered_guided_next, "ordered" )
+    __U_GOMP_UNSUPPORTED__( GOMP_loop_ordered_runtime_next, "ordered" )
+    __U_GOMP_UNSUPPORTED__( GOMP_loop_ull_ordered_static_start, "ordered" )
+    __U_GOMP_UNSUPPORTED__( GOMP_loop_ull_ordered_dynamic_start, "ordered" )
+    __U_GOMP_UNSUPPORTED__( GOMP_loop_ull_ordered_guided_start, "ordered" )
+    __U_GOMP_UNSUPPORTED__( GOMP_loop_ull_ordered_runtime_start, "ordered" )
+    __U_GOMP_UNSUPPORTED__( GOMP_loop_ull_ordered_start, "ordered" )
+    __U_GOMP_UNSUPPORTED__( GOMP_loop_ull_ordered_static_next, "ordered" )
+    __U_GOMP_UNSUPPORTED__( GOMP_loop_ull_ordered_dynamic_next, "ordered" )
+    __U_GOMP_UNSUPPORTED__( GOMP_loop_ull_ordered_guided_next, "ordered" )
+    __U_GOMP_UNSUPPORTED__( GOMP_loop_ull_ordered_runtime_next, "ordered" )
+
+    __U_GOMP_UNSUPPORTED__( GOMP_loop_doacross_static_start, "doacross" )
+    __U_GOMP_UNSUPPORTED__( GOMP_loop_doacross_dynamic_start, "doacross" )
+    __U_GOMP_UNSUPPORTED__( GOMP_loop_doacross_guided_start, "doacross" )
+    __U_GOMP_UNSUPPORTED__( GOMP_loop_doacross_runtime_start, "doacross" )
+    __U_GOMP_UNSUPPORTED__( GOMP_loop_doacross_start, "doacross" )
+    __U_GOMP_UNSUPPORTED__( GOMP_loop_ull_doacross_static_start, "doacross" )
+    __U_GOMP_UNSUPPORTED__( GOMP_loop_ull_doacross_dynamic_start, "doacross" )
+    __U_GOMP_UNSUPPORTED__( GOMP_loop_ull_doacross_guided_start, "doacross" )
+    __U_GOMP_UNSUPPORTED__( GOMP_loop_ull_doacross_runtime_start, "doacross" )
+    __U_GOMP_UNSUPPORTED__( GOMP_loop_ull_doacross_start, "doacross" )
+    __U_GOMP_UNSUPPORTED__( GOMP_doacross_post, "doacross" )
+    __U_GOMP_UNSUPPORTED__( GOMP_doacross_wait, "doacross" )
+    __U_GOMP_UNSUPPORTED__( GOMP_doacross_ull_post, "doacross" )
+    __U_GOMP_UNSUPPORTED__( GOMP_doacross_ull_wait, "doacross" )
+
+    __U_GOMP_UNSUPPORTED__( GOMP_taskwait_depend, "task dependences" )
+    __U_GOMP_UNSUPPORTED__( GOMP_parallel_reductions, "task reductions" )
+    __U_GOMP_UNSUPPORTED__( GOMP_taskgroup_reduction_register, "task reductions" )
+    __U_GOMP_UNSUPPORTED__( GOMP_taskgroup_reduction_unregister, "task reductions" )
+    __U_GOMP_UNSUPPORTED__( GOMP_task_reduction_remap, "task reductions" )
+    __U_GOMP_UNSUPPORTED__( GOMP_workshare_task_reduction_unregister, "task reductions" )
+
+    __U_GOMP_UNSUPPORTED__( GOMP_teams, "teams" )
+    __U_GOMP_UNSUPPORTED__( GOMP_teams4, "teams" )
+    __U_GOMP_UNSUPPORTED__( GOMP_teams_reg, "teams" )
+    __U_GOMP_UNSUPPORTED__( GOMP_target, "target" )
+    __U_GOMP_UNSUPPORTED__( GOMP_target_ext, "target" )
+    __U_GOMP_UNSUPPORTED__( GOMP_target_data, "target" )
+    __U_GOMP_UNSUPPORTED__( GOMP_target_data_ext, "target" )
+    __U_GOMP_UNSUPPORTED__( GOMP_target_end_data, "target" )
+    __U_GOMP_UNSUPPORTED__( GOMP_target_update, "target" )
+    __U_GOMP_UNSUPPORTED__( GOMP_target_update_ext, "target" )
+    __U_GOMP_UNSUPPORTED__( GOMP_target_enter_exit_data, "target" )
+    __U_GOMP_UNSUPPORTED__( GOMP_offload_register, "target" )
+    __U_GOMP_UNSUPPORTED__( GOMP_offload_register_ver, "target" )
+    __U_GOMP_UNSUPPORTED__( GOMP_offload_unregister, "target" )
+    __U_GOMP_UNSUPPORTED__( GOMP_offload_unregister_ver, "target" )
+
+
+    //######################### omp API #########################
+
+
+    int omp_get_thread_num() {
+	return self().id;
+    } // omp_get_thread_num
+
+    int omp_get_num_threads() {
+	return self().team->size;
+    } // omp_get_num_threads
+
+    int omp_get_max_threads() {
+	GOMPMember &m = self();
+	return teamSize( m, 0 );
+    } // omp_get_max_threads
+
+    void omp_set_num_threads( int n ) {
+	pthread_once( &memberOnce, initialize );
+	nthreadsVar = n > 0 ? n : 1;
+    } // omp_set_num_threads
+
+    int omp_get_num_procs() {
+	return uThisCluster().getProcessors();
+    } // omp_get_num_procs
+
+    int omp_in_parallel() {
+	return activeLevels( self() ) > 0;
+    } // omp_in_parallel
+
+    int omp_get_level() {
+	return self().team->level;
+    } // omp_get_level
+
+    int omp_get_active_level() {
+	return activeLevels( self() );
+    } // omp_get_active_level
+
+    void omp_set_dynamic( int flag ) { dynamicVar = flag != 0; }
+    int omp_get_dynamic() { return dynamicVar; }
+
+    void omp_set_nested( int flag ) {
+	pthread_once( &memberOnce, initialize );
+	nestedVar = flag != 0;
+	maxActiveLevelsVar = nestedVar ? ~0u : 1;
+    } // omp_set_nested
+
+    int omp_get_nested() { return nestedVar; }
+
+    void omp_set_max_active_levels( int levels ) {
+	pthread_once( &memberOnce, initialize );
+	maxActiveLevelsVar = levels > 0 ? levels : 0;
+    } // omp_set_max_active_levels
+
+    int omp_get_max_active_levels() { return maxActiveLevelsVar; }
+    int omp_get_thread_limit() { return ~0u >> 1; }
+
+    double omp_get_wtime() {
+	return uClock::currTime().nanoseconds() / 1.0E9;
+    } // omp_get_wtime
+
+    double omp_get_wtick() {
+	return 1.0E-9;
+    } // omp_get_wtick
+
+
+    //######################### omp locks #########################
+
+
+    // omp_lock_t is 4 bytes and omp_nest_lock_t holds a lock, a count and an owner, so neither can contain a uOwnerLock.
+    // Contention is rare in OpenMP code, so a waiting member yields its processor instead of blocking.
+
+    struct GOMPNestLock {
+	int lock;
+	int count;
+	uBaseTask *owner;
+    }; // GOMPNestLock
+
+    void omp_init_lock( int *lock ) { *lock = 0; }
+    void omp_destroy_lock( int * ) {}
+
+    void omp_set_lock( int *lock ) {
+	while ( __atomic_exchange_n( lock, 1, __ATOMIC_ACQUIRE ) != 0 ) uBaseTask::yield();
+    } // omp_set_lock
+
+    void omp_unset_lock( int *lock ) {
+	__atomic_store_n( lock, 0, __ATOMIC_RELEASE );
+    } // omp_unset_lock
+
+    int omp_test_lock( int *lock ) {
+	return __atomic_exchange_n( lock, 1, __ATOMIC_ACQUIRE ) == 0;
+    } // omp_test_lock
+
+    void omp_init_nest_lock( GOMPNestLock *lock ) {
+	lock->lock = lock->count = 0;
+	lock->owner = nullptr;
+    } // omp_init_nest_lock
+
+    void omp_destroy_nest_lock( GOMPNestLock * ) {}
+
+    int omp_test_nest_lock( GOMPNestLock *lock ) {
+	if ( lock->owner != &uThisTask() ) {
+	  if ( ! omp_test_lock( &lock->lock ) ) return 0;
+	    lock->owner = &uThisTask();
+	} // if
+	lock->count += 1;
+	return lock->count;
+    } // omp_test_nest_lock
+
+    void omp_set_nest_lock( GOMPNestLock *lock ) {
+	if ( lock->owner != &uThisTask() ) {
+	    omp_set_lock( &lock->lock );
+	    lock->owner = &uThisTask();
+	} // if
+	lock->count += 1;
+    } // omp_set_nest_lock
+
+    void omp_unset_nest_lock( GOMPNestLock *lock ) {
+	lock->count -= 1;
+	if ( lock->count == 0 ) {
+	    lock->owner = nullptr;
+	    omp_unset_lock( &lock->lock );
+	} // if
+    } // omp_unset_nest_lock
+} // extern "C"
+
+
+// Local Variables: //
+// compile-command: "make install" //
+// End: //
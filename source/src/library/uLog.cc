@@ -0,0 +1,263 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// uLog.cc --
+//
+// Author           : 
+// Created On       : Sun Oct 18 09:40:17 2026
+// Last Modified By : 
+// Last Modified On : Sun Oct 18 09:40:17 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+
+#define __U_KERNEL__
+#include <uC++.h>
+#include <uLog.h>
+
+//#include <uDebug.h>
+
+#include <cstring>					// memcpy
+#include <fcntl.h>					// O_WRONLY, O_CREAT, O_APPEND
+#include <sys/uio.h>					// struct iovec
+
+
+#define __U_LOG_IOV__ 64				// maximum chunks per writev
+
+
+//######################### uLogger #########################
+
+
+uLogger::uLogger( int fd, Policy policy, unsigned int nshards, unsigned int nchunks, size_t chunkSize, uDuration interval ) :
+	policy( policy ), chunkSize( chunkSize ), nchunks( nchunks ), nshards( nshards ), interval( interval ), space( 0 ), work( 0 ) {
+    ufile = new uFile( "uLogger" );
+    ufileacc = new uFile::FileAccess( fd, *ufile );	// does not close fd
+    init();
+} // uLogger::uLogger
+
+
+uLogger::uLogger( const char *name, Policy policy, unsigned int nshards, unsigned int nchunks, size_t chunkSize, uDuration interval ) :
+	policy( policy ), chunkSize( chunkSize ), nchunks( nchunks ), nshards( nshards ), interval( interval ), space( 0 ), work( 0 ) {
+    ufile = nullptr;
+    ufileacc = new uFile::FileAccess( name, O_WRONLY | O_CREAT | O_APPEND );
+    init();
+} // uLogger::uLogger
+
+
+void uLogger::init() {
+    assert( nshards > 0 && nchunks > nshards && chunkSize > 0 );
+    storage = new char[nchunks * chunkSize];
+    chunks = new Chunk[nchunks];
+    for ( unsigned int i = 0; i < nchunks; i += 1 ) {
+	chunks[i].used = 0;
+	chunks[i].data = storage + i * chunkSize;
+	freeChunks.push( &chunks[i] );
+    } // for
+    shards = new Shard[nshards];
+    for ( unsigned int i = 0; i < nshards; i += 1 ) {
+	shards[i].curr = nullptr;
+    } // for
+
+    waiters = 0;
+    flushed = nullptr;
+    done = false;
+    records_ = bytes_ = dropped_ = writes_ = failures_ = 0;
+
+    cluster = new uCluster( "uLogger" );
+    processor = new uProcessor( *cluster );
+    flusher = new Flusher( *cluster, *this );
+} // uLogger::init
+
+
+uLogger::~uLogger() {
+    done = true;
+    work.V();						// final flush of partial chunks
+    delete flusher;					// wait for flusher to finish
+    delete processor;
+    delete cluster;
+    delete ufileacc;
+    delete ufile;
+    delete [] shards;
+    delete [] chunks;
+    delete [] storage;
+} // uLogger::~uLogger
+
+
+// A record is copied into the chunk of the shard selected by the current processor's id, so tasks on different
+// processors rarely contend. A record larger than a chunk is truncated. When the chunk fills, it is queued for the
+// flusher and a free chunk is taken from the pool, otherwise the policy determines if the record is dropped or the
+// logging task blocks until the flusher returns written chunks.
+
+bool uLogger::append( const char *rec, size_t len ) {
+    if ( len > chunkSize ) len = chunkSize;		// truncate oversized record
+    Shard &shard = shards[uThisProcessor().getId() % nshards];
+
+    for ( ;; ) {
+	shard.lock.acquire();
+	Chunk *curr = shard.curr;
+	if ( curr != nullptr && curr->used + len <= chunkSize ) { // fast path
+	    memcpy( curr->data + curr->used, rec, len );
+	    curr->used += len;
+	    shard.lock.release();
+	    uFetchAdd( records_, 1 );
+	    return true;
+	} // if
+
+	poolLock.acquire();
+	if ( curr != nullptr ) {			// retire full chunk
+	    fullChunks.addTail( curr );
+	    shard.curr = nullptr;
+	} // if
+	Chunk *next = freeChunks.pop();
+	if ( next != nullptr ) {
+	    next->used = 0;
+	    shard.curr = next;
+	    poolLock.release();
+	    shard.lock.release();
+	    if ( curr != nullptr ) work.V();		// wake flusher
+	    continue;					// retry with empty chunk
+	} // if
+      if ( policy == Drop ) {
+	    poolLock.release();
+	    shard.lock.release();
+	    if ( curr != nullptr ) work.V();
+	    uFetchAdd( dropped_, 1 );
+	    return false;
+	} // exit
+	waiters += 1;					// backpressure
+	poolLock.release();
+	shard.lock.release();
+	work.V();
+	space.P();					// wait for flusher to return chunks
+    } // for
+} // uLogger::append
+
+
+// Move queued chunks, and optionally the partially filled chunks of each shard, into the batch to be written.
+
+void uLogger::collect( uQueue<Chunk> &batch, bool partial ) {
+    if ( partial ) {
+	for ( unsigned int i = 0; i < nshards; i += 1 ) {
+	    shards[i].lock.acquire();
+	    Chunk *curr = shards[i].curr;
+	    if ( curr != nullptr && curr->used != 0 ) {
+		shards[i].curr = nullptr;
+		poolLock.acquire();
+		fullChunks.addTail( curr );
+		poolLock.release();
+	    } // if
+	    shards[i].lock.release();
+	} // for
+    } // if
+
+    poolLock.acquire();
+    batch.transfer( fullChunks );
+    poolLock.release();
+} // uLogger::collect
+
+
+void uLogger::write( uQueue<Chunk> &batch ) {
+    Chunk *group[__U_LOG_IOV__];
+    struct iovec iov[__U_LOG_IOV__];
+
+    while ( ! batch.empty() ) {
+	int cnt;
+	for ( cnt = 0; cnt < __U_LOG_IOV__ && ! batch.empty(); cnt += 1 ) {
+	    group[cnt] = batch.dropHead();
+	    iov[cnt].iov_base = group[cnt]->data;
+	    iov[cnt].iov_len = group[cnt]->used;
+	} // for
+
+	try {
+	    for ( int first = 0; first < cnt; ) {	// handle partial writes
+		int wlen = ufileacc->writev( &iov[first], cnt - first );
+		writes_ += 1;
+	      if ( wlen <= 0 ) { failures_ += 1; break; }
+		bytes_ += wlen;
+		for ( ; first < cnt && (size_t)wlen >= iov[first].iov_len; first += 1 ) {
+		    wlen -= iov[first].iov_len;
+		} // for
+		if ( first < cnt ) {
+		    iov[first].iov_base = (char *)iov[first].iov_base + wlen;
+		    iov[first].iov_len -= wlen;
+		} // if
+	    } // for
+	} catch( uIOFailure & ) {			// log data is lost, but logging tasks continue
+	    failures_ += 1;
+	} // try
+
+	poolLock.acquire();
+	for ( int i = 0; i < cnt; i += 1 ) {
+	    freeChunks.push( group[i] );
+	} // for
+	unsigned int blocked = waiters;
+	waiters = 0;
+	poolLock.release();
+	if ( blocked != 0 ) space.V( blocked );		// restart logging tasks waiting for chunks
+    } // while
+} // uLogger::write
+
+
+void uLogger::flush() {
+    uSemaphore written( 0 );
+    flushLock.acquire();
+    flushed = &written;
+    work.V();
+    written.P();
+    flushLock.release();
+} // uLogger::flush
+
+
+void uLogger::Flusher::main() {
+    for ( ;; ) {
+	bool timedout = ! logger.work.P( logger.interval ); // wait for full chunks or write partial chunks periodically
+	uSemaphore *flushed = logger.flushed;
+	bool done = logger.done;
+	uQueue<Chunk> batch;
+	logger.collect( batch, timedout || flushed != nullptr || done );
+	logger.write( batch );
+	if ( flushed != nullptr ) {
+	    logger.flushed = nullptr;
+	    flushed->V();
+	} // if
+      if ( done ) break;
+    } // for
+} // uLogger::Flusher::main
+
+
+//######################### uLogRecord #########################
+
+
+uLogRecord::Buf::int_type uLogRecord::Buf::overflow( int_type c ) {
+    size_t used = pptr() - pbase(), size = (epptr() - pbase()) * 2;
+    char *next = new char[size];			// grow formatting buffer
+    memcpy( next, pbase(), used );
+    delete [] heap;
+    heap = next;
+    setp( heap, heap + size );
+    pbump( used );
+    if ( ! traits_type::eq_int_type( c, traits_type::eof() ) ) {
+	*pptr() = traits_type::to_char_type( c );
+	pbump( 1 );
+    } // if
+    return traits_type::not_eof( c );
+} // uLogRecord::Buf::overflow
+
+
+// Local Variables: //
+// compile-command: "make install" //
+// End: //
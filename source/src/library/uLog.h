@@ -0,0 +1,166 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// uLog.h -- asynchronous logging stream
+//
+// Author           : 
+// Created On       : Sun Oct 18 09:12:44 2026
+// Last Modified By : 
+// Last Modified On : Sun Oct 18 09:12:44 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+
+#pragma once
+
+
+#include <ostream>
+#include <uFile.h>
+#include <uQueue.h>
+#include <uStack.h>
+
+
+#define __U_LOG_CHUNK_SIZE__ (64 * 1024)		// bytes per append chunk
+#define __U_LOG_CHUNKS__ 64				// chunks per logger => bounded memory
+#define __U_LOG_RECORD_SIZE__ 256			// formatting buffer for a record before spilling to the heap
+
+
+// A uLogger decouples formatting and I/O for concurrent logging. Records are formatted by the logging task into a
+// private buffer (uLogRecord), then copied into one of several sharded append chunks under a short spin lock; no stream
+// lock is held while formatting and the logging task never performs I/O. Full chunks are written by a flusher task,
+// executing on its own cluster and processor, using writev of many chunks at once. Memory is bounded by a fixed pool of
+// chunks; when the pool is exhausted, the policy either drops the record (counted) or blocks the logging task until the
+// flusher returns chunks (backpressure). Records from a shard appear in order; records from different shards may be
+// reordered with respect to each other.
+
+class uLogger {
+    friend class uLogRecord;				// access: append
+  public:
+    enum Policy { Drop, Block };			// action when all chunks are full
+  private:
+    struct Chunk : public uColable {
+	size_t used;
+	char *data;
+    }; // Chunk
+
+    struct Shard {
+	uSpinLock lock;
+	Chunk *curr;					// partially filled chunk, may be null
+    } __attribute__(( aligned (64) ));			// separate cache lines
+
+    _Task Flusher {
+	uLogger &logger;
+
+	void main();
+      public:
+	Flusher( uCluster &cluster, uLogger &logger ) : uBaseTask( cluster ), logger( logger ) {}
+    }; // Flusher
+
+    uFile *ufile;					// null => file access owns its file
+    uFile::FileAccess *ufileacc;
+    uCluster *cluster;					// flusher I/O never blocks processors of logging tasks
+    uProcessor *processor;
+    Flusher *flusher;
+    const Policy policy;
+    const size_t chunkSize;
+    const unsigned int nchunks, nshards;
+    const uDuration interval;				// maximum delay before partial chunks are written
+    char *storage;
+    Chunk *chunks;
+    Shard *shards;
+
+    uSpinLock poolLock;					// protects freeChunks, fullChunks, waiters
+    uStack<Chunk> freeChunks;
+    uQueue<Chunk> fullChunks;
+    unsigned int waiters;				// tasks blocked for a free chunk
+    uSemaphore space, work;				// logging tasks wait for chunks, flusher waits for work
+
+    uOwnerLock flushLock;				// serialize flush requests
+    uSemaphore *flushed;				// non-null => flusher writes partial chunks and signals
+    volatile bool done;
+
+    volatile size_t records_, bytes_, dropped_, writes_, failures_;
+
+    void init();
+    bool append( const char *rec, size_t len );
+    void collect( uQueue<Chunk> &batch, bool partial );
+    void write( uQueue<Chunk> &batch );
+  public:
+    uLogger( const uLogger & ) = delete;		// no copy
+    uLogger( uLogger && ) = delete;
+    uLogger &operator=( const uLogger & ) = delete;	// no assignment
+
+    uLogger( int fd, Policy policy = Drop, unsigned int nshards = 8, unsigned int nchunks = __U_LOG_CHUNKS__,
+	     size_t chunkSize = __U_LOG_CHUNK_SIZE__, uDuration interval = uDuration( 0, 100000000 ) );
+    uLogger( const char *name, Policy policy = Drop, unsigned int nshards = 8, unsigned int nchunks = __U_LOG_CHUNKS__,
+	     size_t chunkSize = __U_LOG_CHUNK_SIZE__, uDuration interval = uDuration( 0, 100000000 ) );
+    ~uLogger();
+
+    void flush();					// write all appended records and wait for completion
+
+    size_t records() const { return records_; }		// records appended
+    size_t bytes() const { return bytes_; }		// bytes written
+    size_t dropped() const { return dropped_; }		// records discarded by Drop policy
+    size_t writes() const { return writes_; }		// writev calls
+    size_t failures() const { return failures_; }	// writev calls that raised an I/O exception
+}; // uLogger
+
+
+// Formats one record in a task-private buffer and hands it to the logger on destruction, e.g.:
+//
+//    uLogRecord( log ) << "request " << id << " done" << endl;
+
+class uLogRecord {
+    class Buf : public std::streambuf {
+	char local[__U_LOG_RECORD_SIZE__];
+	char *heap;
+      protected:
+	int_type overflow( int_type c );
+      public:
+	Buf() : heap( nullptr ) { setp( local, local + sizeof(local) ); }
+	~Buf() { delete [] heap; }
+	const char *data() const { return pbase(); }
+	size_t size() const { return pptr() - pbase(); }
+    }; // Buf
+
+    uLogger &logger;
+    Buf buf;
+    std::ostream os;
+  public:
+    uLogRecord( const uLogRecord & ) = delete;		// no copy
+    uLogRecord( uLogRecord && ) = delete;
+    uLogRecord &operator=( const uLogRecord & ) = delete; // no assignment
+
+    uLogRecord( uLogger &logger ) : logger( logger ), os( &buf ) {}
+    ~uLogRecord() {
+	if ( buf.size() != 0 ) logger.append( buf.data(), buf.size() );
+    } // uLogRecord::~uLogRecord
+
+    template< typename datatype >
+    std::ostream &operator<<( const datatype &data ) {
+	return os << data;
+    } // uLogRecord::operator<<
+
+    std::ostream &operator<<( std::ostream &(*manip)( std::ostream & ) ) {
+	return os << manip;
+    } // uLogRecord::operator<<
+}; // uLogRecord
+
+
+// Local Variables: //
+// compile-command: "make install" //
+// End: //
@@ -35,6 +35,7 @@
 #include <cstring>					// strerror, memset
 #include <unistd.h>					// read, write, close, etc.
 #include <sys/sendfile.h>
+#include <linux/errqueue.h>				// sock_extended_err, SO_EE_ORIGIN_ZEROCOPY
 
 #ifndef SUN_LEN
 #define SUN_LEN(su) (sizeof(*(su)) - sizeof((su)->sun_path) + strlen((su)->sun_path))
@@ -211,6 +212,77 @@ int uSocketIO::sendto( char *buf, int len, struct sockaddr *to, socklen_t tolen,
 } // uSocketIO::sendto
 
 
+int uSocketIO::sendmsg( const struct msghdr *msg, int flags, uDuration *timeout ) {
+    int slen;
+
+    struct Sendmsg : public uIOClosure {
+	const struct msghdr *msg;
+	int flags;
+
+	int action() { return ::sendmsg( access.fd, msg, flags ); }
+	Sendmsg( uIOaccess &access, int &slen, const struct msghdr *msg, int flags ) : uIOClosure( access, slen ), msg( msg ), flags( flags ) {}
+    } sendmsgClosure( access, slen, msg, flags );
+
+    sendmsgClosure.wrapper();
+    if ( slen == -1 && sendmsgClosure.errno_ == U_EWOULDBLOCK ) {
+	if ( ! sendmsgClosure.select( uCluster::WriteSelect, timeout ) ) {
+	    writeTimeout( (const char *)msg, 0, flags, nullptr, 0, timeout, "sendmsg" );
+	} // if
+    } // if
+    if ( slen == -1 ) {
+	writeFailure( sendmsgClosure.errno_, (const char *)msg, 0, flags, nullptr, 0, timeout, "sendmsg" );
+    } // if
+
+    return slen;
+} // uSocketIO::sendmsg
+
+
+int uSocketIO::sendmmsg( struct mmsghdr *msgvec, unsigned int vlen, int flags, uDuration *timeout ) {
+    int slen;
+
+    struct Sendmmsg : public uIOClosure {
+	struct mmsghdr *msgvec;
+	unsigned int vlen;
+	int flags;
+
+	int action() {
+#ifdef __U_STATISTICS__
+	    uFetchAdd( UPP::Statistics::mmsg_syscalls, 1 );
+#endif // __U_STATISTICS__
+	    return ::sendmmsg( access.fd, msgvec, vlen, flags );
+	} // action
+	Sendmmsg( uIOaccess &access, int &slen, int flags ) : uIOClosure( access, slen ), flags( flags ) {}
+    } sendmmsgClosure( access, slen, flags );
+
+    // A partial batch means the socket send-buffer filled, so the remaining messages are resubmitted after the socket
+    // becomes writable. The poller resends on behalf of the task, so each wakeup carries as many messages as fit.
+
+    for ( unsigned int count = 0;; ) {			// ensure all messages are sent
+	sendmmsgClosure.msgvec = msgvec + count;
+	sendmmsgClosure.vlen = vlen - count;
+	sendmmsgClosure.wrapper();
+	if ( slen == -1 && sendmmsgClosure.errno_ == U_EWOULDBLOCK ) {
+#ifdef __U_STATISTICS__
+	    uFetchAdd( UPP::Statistics::mmsg_eagain, 1 );
+#endif // __U_STATISTICS__
+	    if ( ! sendmmsgClosure.select( uCluster::WriteSelect, timeout ) ) {
+		writeTimeout( (const char *)msgvec, vlen, flags, nullptr, 0, timeout, "sendmmsg" );
+	    } // if
+	} // if
+	if ( slen == -1 ) {
+	    writeFailure( sendmmsgClosure.errno_, (const char *)msgvec, vlen, flags, nullptr, 0, timeout, "sendmmsg" );
+	} // if
+	count += slen;
+#ifdef __U_STATISTICS__
+	uFetchAdd( UPP::Statistics::mmsg_messages, slen );
+#endif // __U_STATISTICS__
+      if ( count == vlen ) break;			// transferred across all sends
+    } // for
+
+    return vlen;					// always return the specified length
+} // uSocketIO::sendmmsg
+
+
 int uSocketIO::recv( char *buf, int len, int flags, uDuration *timeout ) {
     int rlen;
 
@@ -295,6 +367,46 @@ int uSocketIO::recvmsg( struct msghdr *msg, int flags, uDuration *timeout ) {
 } // uSocketIO::recvmsg
 
 
+int uSocketIO::recvmmsg( struct mmsghdr *msgvec, unsigned int vlen, int flags, uDuration *timeout ) {
+    int rlen;
+
+    struct Recvmmsg : public uIOClosure {
+	struct mmsghdr *msgvec;
+	unsigned int vlen;
+	int flags;
+
+	int action() {
+#ifdef __U_STATISTICS__
+	    uFetchAdd( UPP::Statistics::mmsg_syscalls, 1 );
+#endif // __U_STATISTICS__
+	    // Socket is nonblocking, so the call returns as soon as the pending datagrams are consumed, even if fewer
+	    // than vlen; no timeout is passed because the uNBIO select provides the blocking.
+	    return ::recvmmsg( access.fd, msgvec, vlen, flags, nullptr );
+	} // action
+	Recvmmsg( uIOaccess &access, int &rlen, struct mmsghdr *msgvec, unsigned int vlen, int flags ) :
+	    uIOClosure( access, rlen ), msgvec( msgvec ), vlen( vlen ), flags( flags ) {}
+    } recvmmsgClosure( access, rlen, msgvec, vlen, flags );
+
+    recvmmsgClosure.wrapper();
+    if ( rlen == -1 && recvmmsgClosure.errno_ == U_EWOULDBLOCK ) {
+#ifdef __U_STATISTICS__
+	uFetchAdd( UPP::Statistics::mmsg_eagain, 1 );
+#endif // __U_STATISTICS__
+	if ( ! recvmmsgClosure.select( uCluster::ReadSelect, timeout ) ) {
+	    readTimeout( (const char *)msgvec, vlen, flags, nullptr, nullptr, timeout, "recvmmsg" );
+	} // if
+    } // if
+    if ( rlen == -1 ) {
+	readFailure( recvmmsgClosure.errno_, (const char *)msgvec, vlen, flags, nullptr, nullptr, timeout, "recvmmsg" );
+    } // if
+
+#ifdef __U_STATISTICS__
+    uFetchAdd( UPP::Statistics::mmsg_messages, rlen );
+#endif // __U_STATISTICS__
+    return rlen;					// number of messages received
+} // uSocketIO::recvmmsg
+
+
 ssize_t uSocketIO::sendfile( uFile::FileAccess &file, off_t *off, size_t len, uDuration *timeout ) {
     int ret;
     off_t wlen;
@@ -365,6 +477,109 @@ ssize_t uSocketIO::sendfile( uFile::FileAccess &file, off_t *off, size_t len, uD
 } // uSocketIO::sendfile
 
 
+// Completion notifications for MSG_ZEROCOPY sends are queued on the socket error queue as ranges of send ids, where ids
+// are assigned by the kernel in send order starting at 0. Enabling SO_SELECT_ERR_QUEUE reports a nonempty error queue
+// as an exceptional condition, so a task waiting for completions is not woken by ordinary incoming data.
+
+int uSocketIO::setZeroCopy( bool enable ) {
+    int value = enable;
+    if ( setsockopt( SOL_SOCKET, SO_ZEROCOPY, &value, sizeof(value) ) == -1 ) return -1;
+    zcEnabled = enable;
+    return setsockopt( SOL_SOCKET, SO_SELECT_ERR_QUEUE, &value, sizeof(value) );
+} // uSocketIO::setZeroCopy
+
+
+int uSocketIO::sendZeroCopy( const char *buf, int len, uint32_t &id, int flags, uDuration *timeout ) {
+    int slen;
+
+    struct Send : public uIOClosure {
+	const char *buf;
+	int len;
+	int flags;
+
+	int action() { return ::send( access.fd, buf, len, flags ); }
+	Send( uIOaccess &access, int &slen, const char *buf, int len, int flags ) : uIOClosure( access, slen ), buf( buf ), len( len ), flags( flags ) {}
+    } sendClosure( access, slen, buf, len, flags | MSG_ZEROCOPY );
+
+    sendClosure.wrapper();
+    if ( slen == -1 && sendClosure.errno_ == U_EWOULDBLOCK ) {
+	if ( ! sendClosure.select( uCluster::WriteSelect, timeout ) ) {
+	    writeTimeout( buf, len, flags, nullptr, 0, timeout, "sendZeroCopy" );
+	} // if
+    } // if
+    if ( slen == -1 ) {
+	writeFailure( sendClosure.errno_, buf, len, flags, nullptr, 0, timeout, "sendZeroCopy" );
+    } // if
+
+    // A failed send does not consume an id, so ids are only assigned after success (mutex member => kernel order).
+    // Without SO_ZEROCOPY, the kernel ignores MSG_ZEROCOPY and copies buf, so the send is already complete and takes no
+    // kernel id.
+    if ( zcEnabled ) {
+	id = zcNext;
+	zcNext += 1;
+#ifdef __U_STATISTICS__
+	uFetchAdd( UPP::Statistics::zerocopy_sends, 1 );
+#endif // __U_STATISTICS__
+    } else {
+	id = zcDone - 1;				// completed id
+    } // if
+    return slen;
+} // uSocketIO::sendZeroCopy
+
+
+bool uSocketIO::zeroCopyCompleted( uint32_t id ) {
+    for ( ;; ) {					// reap all pending notifications
+	char control[CMSG_SPACE( sizeof(sock_extended_err) ) + CMSG_SPACE( sizeof(sockaddr_in6) )];
+	msghdr msg;
+	memset( &msg, '\0', sizeof(msg) );
+	msg.msg_control = control;
+	msg.msg_controllen = sizeof(control);
+
+	int retcode;
+	for ( ;; ) {
+	    retcode = ::recvmsg( access.fd, &msg, MSG_ERRQUEUE | MSG_DONTWAIT );
+	  if ( retcode != -1 || errno != EINTR ) break;	// timer interrupt ?
+	} // for
+      if ( retcode == -1 ) break;			// EAGAIN => error queue empty
+
+	for ( cmsghdr *cm = CMSG_FIRSTHDR( &msg ); cm != nullptr; cm = CMSG_NXTHDR( &msg, cm ) ) {
+	  if ( ! ( (cm->cmsg_level == SOL_IP && cm->cmsg_type == IP_RECVERR) ||
+		   (cm->cmsg_level == SOL_IPV6 && cm->cmsg_type == IPV6_RECVERR) ) ) continue;
+	    const sock_extended_err *serr = (const sock_extended_err *)CMSG_DATA( cm );
+	  if ( serr->ee_errno != 0 || serr->ee_origin != SO_EE_ORIGIN_ZEROCOPY ) continue;
+	    // ee_info..ee_data is an inclusive range of completed ids. Completions on a stream socket arrive in send
+	    // order, so advance the completion point to the end of the range (wrap-around safe).
+	    uint32_t next = serr->ee_data + 1;
+#ifdef __U_STATISTICS__
+	    uFetchAdd( UPP::Statistics::zerocopy_completions, serr->ee_data - serr->ee_info + 1 );
+	    if ( serr->ee_code & SO_EE_CODE_ZEROCOPY_COPIED ) { // kernel fell back to copying (e.g., loopback)
+		uFetchAdd( UPP::Statistics::zerocopy_copied, serr->ee_data - serr->ee_info + 1 );
+	    } // if
+#endif // __U_STATISTICS__
+	    for ( uint32_t done = zcDone; (int32_t)(next - done) > 0 && ! uCompareAssignValue( zcDone, done, next ); );
+	} // for
+    } // for
+
+    return (int32_t)(id - zcDone) < 0;
+} // uSocketIO::zeroCopyCompleted
+
+
+void uSocketIO::zeroCopyWait( uint32_t id, uDuration *timeout ) {
+    struct Ready : public uIOClosure {
+	int action() { return 0; }			// notifications reaped by waiting task
+	Ready( uIOaccess &access, int &retcode ) : uIOClosure( access, retcode ) {}
+    }; // Ready
+
+    while ( ! zeroCopyCompleted( id ) ) {
+	int retcode;
+	Ready ready( access, retcode );
+	if ( ! ready.select( uCluster::ExceptSelect, timeout ) ) {
+	    readTimeout( nullptr, 0, MSG_ERRQUEUE, nullptr, nullptr, timeout, "zeroCopyWait" );
+	} // if
+    } // while
+} // uSocketIO::zeroCopyWait
+
+
 //######################### uSocketServer #########################
 
 
@@ -667,17 +882,19 @@ void uSocketAccept::close() {
 //######################### uSocketClient #########################
 
 
-void uSocketClient::connectionOriented( const char *name, unsigned short port, const int domain, uDuration *timeout, int type, int protocol ) {
-    int retcode;
+struct uSocketConnect : public uIOClosure {
+    struct sockaddr *adr;
+    socklen_t len;
+    bool doConnect;
+
+    int action() { return doConnect ? ::connect( access.fd, adr, len ) : 0; }
+    uSocketConnect( uIOaccess &access, int &retcode, struct sockaddr *adr, socklen_t len ) : uIOClosure( access, retcode ), adr( adr ), len( len ), doConnect( true ) {}
+}; // uSocketConnect
 
-    struct Connect : public uIOClosure {
-	struct sockaddr *adr;
-	socklen_t len;
-	bool doConnect;
 
-	int action() { return doConnect ? ::connect( access.fd, adr, len ) : 0; }
-	Connect( uIOaccess &access, int &retcode, struct sockaddr *adr, socklen_t len ) : uIOClosure( access, retcode ), adr( adr ), len( len ), doConnect( true ) {}
-    } connectClosure( socket.access, retcode, saddr, saddrlen );
+void uSocketClient::connectionOriented( const char *name, unsigned short port, const int domain, uDuration *timeout, int type, int protocol ) {
+    int retcode;
+    uSocketConnect connectClosure( socket.access, retcode, saddr, saddrlen );
 
     connectClosure.wrapper();
     if ( retcode == -1 && connectClosure.errno_ == U_EWOULDBLOCK ) {
@@ -686,16 +903,8 @@ void uSocketClient::connectionOriented( const char *name, unsigned short port, c
 	} // if
     } // if
     if ( retcode == -1 && connectClosure.errno_ == EINPROGRESS ) {
-	// wait for a non-blocking connect to complete without issuing the connect again
-	connectClosure.doConnect = false;
-	if ( ! connectClosure.select( uCluster::WriteSelect, timeout ) ) {
-	    openTimeout( name, port, uSocket::itoip( 0 ), timeout, domain, type, protocol, "timeout during connect" );
-	} // if
-	// check if connection completed
-	socklen_t retcodeLen = sizeof(retcode);
-	if ( ::getsockopt( socket.access.fd, SOL_SOCKET, SO_ERROR, &retcode, &retcodeLen ) == -1 ) {
-	    openFailure( connectClosure.errno_, name, port, uSocket::itoip( 0 ), timeout, domain, type, protocol, "unable to connect to socket" );
-	} // if
+	connectWait( name, port, domain, timeout, type, protocol );
+	return;
     } // if
     if ( retcode == -1 ) {
 	openFailure( connectClosure.errno_, name, port, uSocket::itoip( 0 ), timeout, domain, type, protocol, "unable to connect to socket" );
@@ -703,6 +912,47 @@ void uSocketClient::connectionOriented( const char *name, unsigned short port, c
 } // uSocketClient::connectionOriented
 
 
+// Issue a connect without waiting for it to complete; connectWait completes it.
+
+void uSocketClient::connectStart( unsigned short port, uDuration *timeout, int type, int protocol ) {
+    int retcode;
+    uSocketConnect connectClosure( socket.access, retcode, saddr, saddrlen );
+
+    connectClosure.wrapper();
+    if ( retcode == -1 && connectClosure.errno_ != EINPROGRESS ) {
+	openFailure( connectClosure.errno_, "", port, uSocket::itoip( 0 ), timeout, AF_INET, type, protocol, "unable to connect to socket" );
+    } // if
+} // uSocketClient::connectStart
+
+
+// Wait for a connect in progress to complete, without issuing the connect again. If deadline is not null, it replaces
+// timeout as the time limit and timeout is only reported in an exception.
+
+void uSocketClient::connectWait( const char *name, unsigned short port, const int domain, uDuration *timeout, int type, int protocol, const uTime *deadline ) {
+    int retcode;
+    uSocketConnect connectClosure( socket.access, retcode, saddr, saddrlen );
+    connectClosure.doConnect = false;
+
+    uDuration left, *limit = timeout;
+    if ( deadline != nullptr ) {
+	left = *deadline - uClock::currTime();
+	if ( left < 0 ) left = 0;
+	limit = &left;
+    } // if
+    if ( ! connectClosure.select( uCluster::WriteSelect, limit ) ) {
+	openTimeout( name, port, uSocket::itoip( 0 ), timeout, domain, type, protocol, "timeout during connect" );
+    } // if
+    // check if connection completed
+    socklen_t retcodeLen = sizeof(retcode);
+    if ( ::getsockopt( socket.access.fd, SOL_SOCKET, SO_ERROR, &retcode, &retcodeLen ) == -1 ) {
+	openFailure( errno, name, port, uSocket::itoip( 0 ), timeout, domain, type, protocol, "unable to connect to socket" );
+    } // if
+    if ( retcode != 0 ) {				// SO_ERROR is the errno of the failed connect
+	openFailure( retcode, name, port, uSocket::itoip( 0 ), timeout, domain, type, protocol, "unable to connect to socket" );
+    } // if
+} // uSocketClient::connectWait
+
+
 void uSocketClient::createSocketClient1( const char *name, uDuration *timeout, int type, int protocol ) {
     uDEBUGPRT( uDebugPrt( "(uSocketClient &)%p.createSocketClient1 attempting connection to name:%s\n", this, name ); )
 
@@ -869,6 +1119,137 @@ uSocketClient::~uSocketClient() {
 } // uSocketClient::~uSocketClient
 
 
+//######################### uSocketClientPool #########################
+
+
+uSocketClientPool::~uSocketClientPool() {
+    for ( Endpoint *endpoint = endpoints.dropHead(); endpoint != nullptr; endpoint = endpoints.dropHead() ) {
+	for ( Idle *idle = endpoint->idle.dropHead(); idle != nullptr; idle = endpoint->idle.dropHead() ) {
+	    delete idle->client;
+	    delete idle;
+	} // for
+	delete endpoint;
+    } // for
+} // uSocketClientPool::~uSocketClientPool
+
+
+uSocketClientPool::Endpoint *uSocketClientPool::lookup( unsigned short port, in_addr ip, int type, int protocol ) {
+    Endpoint *endpoint;
+    for ( uSeqIter<Endpoint> iter( endpoints ); iter >> endpoint; ) { // few endpoints => linear search
+	if ( endpoint->port == port && endpoint->ip.s_addr == ip.s_addr && endpoint->type == type && endpoint->protocol == protocol ) {
+	    return endpoint;
+	} // if
+    } // for
+    return nullptr;
+} // uSocketClientPool::lookup
+
+
+void uSocketClientPool::discard( Endpoint *endpoint, Idle *idle ) {
+    endpoint->idle.remove( idle );
+    endpoint->count -= 1;
+    delete idle->client;				// close connection
+    delete idle;
+} // uSocketClientPool::discard
+
+
+// An idle client is healthy if nothing can be read: end-of-file or an error means the server closed or reset the
+// connection, and unsolicited data means the previous exchange did not complete.
+
+bool uSocketClientPool::healthy( uSocketClient *client ) {
+    char byte;
+    int rc;
+    for ( ;; ) {
+	rc = ::recv( client->fd(), &byte, sizeof(byte), MSG_PEEK | MSG_DONTWAIT );
+      if ( rc != -1 || errno != EINTR ) break;		// timer interrupt ?
+    } // for
+    return rc == -1 && ( errno == EAGAIN || errno == EWOULDBLOCK );
+} // uSocketClientPool::healthy
+
+
+void uSocketClientPool::checkout( unsigned short port, in_addr ip, uSocketClient *clients[], unsigned int n, uDuration *timeout, int type, int protocol ) {
+#ifdef __U_DEBUG__
+    if ( &uThisCluster() != &cluster ) {
+	abort( "(uSocketClientPool &)%p.checkout( port:%d, ... ) : Task %.256s (%p) on cluster %.256s (%p) is not on pool's cluster %.256s (%p).",
+	       this, port, uThisTask().getName(), &uThisTask(), uThisCluster().getName(), &uThisCluster(), cluster.getName(), &cluster );
+    } // if
+#endif // __U_DEBUG__
+
+    unsigned int reused, created, i;
+    for ( reused = 0; reused < n; reused += 1 ) {	// reuse idle clients without holding the pool during connects
+	clients[reused] = reuse( port, ip, type, protocol );
+      if ( clients[reused] == nullptr ) break;
+    } // for
+  if ( reused == n ) return;
+
+    uTime deadline;
+    if ( timeout != nullptr ) deadline = uClock::currTime() + *timeout;
+    created = reused;
+    try {
+	while ( created < n ) {				// start all handshakes before waiting for any
+	    clients[created] = new uSocketClient( port, ip, uSocketClient::deferred, type, protocol );
+	    created += 1;
+	    clients[created - 1]->connectStart( port, timeout, type, protocol );
+	} // while
+	for ( i = reused; i < n; i += 1 ) {		// a completed connect is writable, so it does not block
+	    clients[i]->connectWait( "", port, AF_INET, timeout, type, protocol, timeout != nullptr ? &deadline : nullptr );
+	} // for
+    } catch ( uSocket::Failure & ) {			// socket creation or connection failure
+	for ( i = 0; i < reused; i += 1 ) checkin( clients[i] );
+	for ( i = reused; i < created; i += 1 ) delete clients[i];
+	_Throw;
+    } // try
+} // uSocketClientPool::checkout
+
+
+uSocketClient *uSocketClientPool::reuse( unsigned short port, in_addr ip, int type, int protocol ) {
+    Endpoint *endpoint = lookup( port, ip, type, protocol );
+  if ( endpoint == nullptr ) return nullptr;
+    uTime now = uClock::currTime();
+    for ( ;; ) {
+	Idle *idle = endpoint->idle.head();
+      if ( idle == nullptr ) return nullptr;
+	if ( now - idle->since < maxIdleTime && healthy( idle->client ) ) {
+	    uSocketClient *client = idle->client;
+	    endpoint->idle.remove( idle );
+	    endpoint->count -= 1;
+	    delete idle;
+	    return client;
+	} // if
+	discard( endpoint, idle );			// stale or closed by server
+    } // for
+} // uSocketClientPool::reuse
+
+
+void uSocketClientPool::checkin( uSocketClient *client, bool reusable ) {
+    if ( ! reusable ) {
+	delete client;
+	return;
+    } // if
+
+    const sockaddr_in *addr = (const sockaddr_in *)client->saddr;
+    Endpoint *endpoint = lookup( ntohs( addr->sin_port ), addr->sin_addr, client->socket.type, client->socket.protocol );
+    if ( endpoint == nullptr ) {
+	endpoint = new Endpoint( ntohs( addr->sin_port ), addr->sin_addr, client->socket.type, client->socket.protocol );
+	endpoints.addTail( endpoint );
+    } // if
+
+    uTime now = uClock::currTime();
+    endpoint->idle.addHead( new Idle( client, now ) );
+    endpoint->count += 1;
+    for ( ;; ) {					// trim oldest idle clients, which are at the tail
+	Idle *oldest = endpoint->idle.tail();
+      if ( oldest == nullptr || ( endpoint->count <= maxIdle && now - oldest->since < maxIdleTime ) ) break;
+	discard( endpoint, oldest );
+    } // for
+} // uSocketClientPool::checkin
+
+
+unsigned int uSocketClientPool::idle( unsigned short port, in_addr ip, int type, int protocol ) {
+    Endpoint *endpoint = lookup( port, ip, type, protocol );
+    return endpoint == nullptr ? 0 : endpoint->count;
+} // uSocketClientPool::idle
+
+
 //######################### uSocketServer (cont) #########################
 
 
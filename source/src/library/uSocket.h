@@ -38,6 +38,14 @@
 #include <sys/socket.h>
 #include <sys/un.h>
 #include <netinet/in.h>
+#include <netinet/udp.h>					// UDP_SEGMENT, UDP_GRO
+
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103					// linux/udp.h, GSO segment size
+#endif // UDP_SEGMENT
+#ifndef UDP_GRO
+#define UDP_GRO 104					// linux/udp.h, GRO coalescing
+#endif // UDP_GRO
 
 
 //######################### uSocket #########################
@@ -130,6 +138,9 @@ class uSocketIO : public uFileIO {
     struct sockaddr *saddr;				// default send/receive address
     socklen_t saddrlen;					// size of send address
     socklen_t baddrlen;					// size of address buffer (UNIX/INET)
+    uint32_t zcNext;					// kernel id of next MSG_ZEROCOPY send
+    volatile uint32_t zcDone;				// MSG_ZEROCOPY sends with id < zcDone are complete
+    bool zcEnabled;					// SO_ZEROCOPY set => kernel assigns send ids
 
     using uFileIO::readFailure;
     using uFileIO::readTimeout;
@@ -143,7 +154,7 @@ class uSocketIO : public uFileIO {
     virtual void sendfileFailure( int errno_, const int in_fd, const off_t *off, const size_t len, const uDuration *timeout ) = 0;
     virtual void sendfileTimeout( const int in_fd, const off_t *off, const size_t len, const uDuration *timeout ) = 0;
 
-    uSocketIO( uIOaccess &acc, struct sockaddr *saddr ) : uFileIO( acc ), saddr( saddr ) {
+    uSocketIO( uIOaccess &acc, struct sockaddr *saddr ) : uFileIO( acc ), saddr( saddr ), zcNext( 0 ), zcDone( 0 ), zcEnabled( false ) {
     } // uSocketIO::uSocketIO
   public:
     _Mutex const struct sockaddr *getsockaddr() {	// must cast result to sockaddr_in or sockaddr_un
@@ -158,6 +169,27 @@ class uSocketIO : public uFileIO {
 	return ::getpeername( access.fd, name, len );
     } // uSocketIO::getpeername
 
+    _Mutex int getsockopt( int level, int optname, void *optval, socklen_t *optlen ) {
+	return ::getsockopt( access.fd, level, optname, optval, optlen );
+    } // uSocketIO::getsockopt
+
+    _Mutex int setsockopt( int level, int optname, const void *optval, socklen_t optlen ) {
+	return ::setsockopt( access.fd, level, optname, optval, optlen );
+    } // uSocketIO::setsockopt
+
+    // UDP generic segmentation offload: each send buffer is split by the kernel into datagrams of segsize bytes (0
+    // => off), so one sendto/sendmmsg entry can carry many datagrams.
+    int setGSO( int segsize ) {
+	return setsockopt( SOL_UDP, UDP_SEGMENT, &segsize, sizeof(segsize) );
+    } // uSocketIO::setGSO
+
+    // UDP generic receive offload: the kernel coalesces consecutive datagrams from the same flow into one receive
+    // buffer, and reports the segment size in a UDP_GRO control message.
+    int setGRO( bool enable ) {
+	int value = enable;
+	return setsockopt( SOL_UDP, UDP_GRO, &value, sizeof(value) );
+    } // uSocketIO::setGRO
+
     int send( char *buf, int len, int flags = 0, uDuration *timeout = nullptr );
     int sendto( char *buf, int len, struct sockaddr *to, socklen_t tolen, int flags = 0, uDuration *timeout = nullptr );
 
@@ -166,6 +198,7 @@ class uSocketIO : public uFileIO {
     } // uSocketIO::sendto
 
     int sendmsg( const struct msghdr *msg, int flags = 0, uDuration *timeout = nullptr );
+    int sendmmsg( struct mmsghdr *msgvec, unsigned int vlen, int flags = 0, uDuration *timeout = nullptr );
     int recv( char *buf, int len, int flags = 0, uDuration *timeout = nullptr );
     int recvfrom( char *buf, int len, struct sockaddr *from, socklen_t *fromlen, int flags = 0, uDuration *timeout = nullptr );
 
@@ -175,8 +208,16 @@ class uSocketIO : public uFileIO {
     } // uSocketIO::recvfrom
 
     int recvmsg( struct msghdr *msg, int flags = 0, uDuration *timeout = nullptr );
+    int recvmmsg( struct mmsghdr *msgvec, unsigned int vlen, int flags = 0, uDuration *timeout = nullptr );
 
     ssize_t sendfile( uFile::FileAccess &file, off_t *off, size_t len, uDuration *timeout = nullptr );
+
+    // MSG_ZEROCOPY sends: the kernel pins buf instead of copying it, so buf must not be modified until the send
+    // identified by id is complete. Completions are reaped from the socket error queue.
+    int setZeroCopy( bool enable );
+    _Mutex int sendZeroCopy( const char *buf, int len, uint32_t &id, int flags = 0, uDuration *timeout = nullptr );
+    bool zeroCopyCompleted( uint32_t id );		// nonblocking
+    void zeroCopyWait( uint32_t id, uDuration *timeout = nullptr );
 }; // uSocketIO
 
 
@@ -539,6 +580,19 @@ _Monitor uSocketClient : public uSocketIO {
     void connectionOriented( const char *name, unsigned short port, const int domain, uDuration *timeout, int type, int protocol );
     void createSocketClient1( const char *name, uDuration *timeout, int type, int protocol );
     void createSocketClient2( unsigned short port, const char *name, uDuration *timeout, int type, int protocol );
+
+    friend class uSocketClientPool;			// access: uSocketClient, connectStart, connectWait, saddr, socket
+
+    enum Deferred { deferred };
+
+    // AF_INET, other host, connection started later by connectStart/connectWait
+    uSocketClient( unsigned short port, in_addr ip, Deferred, int type, int protocol ) :
+	    uSocketIO( socket.access, (sockaddr *)new inetAddr( port, ip ) ), socket( AF_INET, type, protocol ) {
+	baddrlen = saddrlen = sizeof(sockaddr_in);
+    } // uSocketClient::uSocketClient
+
+    void connectStart( unsigned short port, uDuration *timeout, int type, int protocol );
+    void connectWait( const char *name, unsigned short port, const int domain, uDuration *timeout, int type, int protocol, const uTime *deadline = nullptr );
   protected:
     void readFailure( int errno_, const char *buf, const int len, const uDuration *timeout, const char *const op ) __attribute__ ((noreturn));
     void readTimeout( const char *buf, const int len, const uDuration *timeout, const char *const op ) __attribute__ ((noreturn));
@@ -704,6 +758,93 @@ _Monitor uSocketClient : public uSocketIO {
 }; // uSocketClient
 
 
+//######################### uSocketClientPool #########################
+
+
+// Connected AF_INET stream clients kept for reuse, so a request does not pay a connection handshake. Idle clients are
+// grouped by endpoint (address, port, type, protocol), most recently returned first. An idle client is discarded
+// rather than reused once it has been idle for maxIdleTime or its server has closed the connection. New connections
+// for a checkout are started together, so their handshakes overlap. Client I/O is polled by the cluster that created
+// the client, so a pool is used only by tasks on the cluster that created it.
+
+_Monitor uSocketClientPool {
+    struct Idle : public uSeqable {
+	uSocketClient *client;
+	uTime since;					// time returned to the pool
+
+	Idle( uSocketClient *client, uTime since ) : client( client ), since( since ) {}
+    }; // Idle
+
+    struct Endpoint : public uSeqable {
+	const unsigned short port;
+	const in_addr ip;
+	const int type, protocol;
+	unsigned int count;				// number of idle clients
+	uSequence<Idle> idle;				// most recently returned at head
+
+	Endpoint( unsigned short port, in_addr ip, int type, int protocol ) : port( port ), ip( ip ), type( type ), protocol( protocol ), count( 0 ) {}
+    }; // Endpoint
+
+    uCluster &cluster;					// cluster polling the pool's clients
+    const unsigned int maxIdle;				// maximum idle clients per endpoint
+    const uDuration maxIdleTime;			// maximum time a client stays idle
+    uSequence<Endpoint> endpoints;
+
+    Endpoint *lookup( unsigned short port, in_addr ip, int type, int protocol );
+    void discard( Endpoint *endpoint, Idle *idle );
+    static bool healthy( uSocketClient *client );
+  public:
+    uSocketClientPool( unsigned int maxIdle = 8, uDuration maxIdleTime = 60 ) :
+	    cluster( uThisCluster() ), maxIdle( maxIdle ), maxIdleTime( maxIdleTime ) {
+    } // uSocketClientPool::uSocketClientPool
+
+    ~uSocketClientPool();
+
+    // Return n connected clients in clients, reusing healthy idle clients and starting the remaining connections
+    // together. The timeout bounds the whole checkout. If any connection fails, reused clients are returned, new
+    // clients are deleted, and uSocketClient::OpenFailure or uSocketClient::OpenTimeout is raised.
+    _Nomutex void checkout( unsigned short port, in_addr ip, uSocketClient *clients[], unsigned int n, uDuration *timeout = nullptr, int type = SOCK_STREAM, int protocol = 0 );
+
+    _Nomutex uSocketClient *checkout( unsigned short port, in_addr ip, uDuration *timeout = nullptr, int type = SOCK_STREAM, int protocol = 0 ) {
+	uSocketClient *client;
+	checkout( port, ip, &client, 1, timeout, type, protocol );
+	return client;
+    } // uSocketClientPool::checkout
+
+    uSocketClient *reuse( unsigned short port, in_addr ip, int type = SOCK_STREAM, int protocol = 0 ); // nullptr => none idle
+
+    // Give a checked-out client back to the pool. A client whose I/O raised an exception, or whose connection state is
+    // unknown (e.g., partial request or response), must be returned with reusable false, which deletes it.
+    void checkin( uSocketClient *client, bool reusable = true );
+
+    unsigned int idle( unsigned short port, in_addr ip, int type = SOCK_STREAM, int protocol = 0 );
+
+    class Lease {					// checkout for a scope
+	uSocketClientPool &pool;
+	uSocketClient *client_;
+      public:
+	Lease( uSocketClientPool &pool, unsigned short port, in_addr ip, uDuration *timeout = nullptr, int type = SOCK_STREAM, int protocol = 0 ) :
+		pool( pool ), client_( pool.checkout( port, ip, timeout, type, protocol ) ) {
+	} // uSocketClientPool::Lease::Lease
+
+	Lease( const Lease & ) = delete;		// no copy
+	Lease &operator=( const Lease & ) = delete;	// no assignment
+
+	~Lease() {					// returned client is not reused if an exception is propagating
+	    if ( client_ != nullptr ) pool.checkin( client_, ! std::__U_UNCAUGHT_EXCEPTION__() );
+	} // uSocketClientPool::Lease::~Lease
+
+	uSocketClient &client() { return *client_; }
+	uSocketClient *operator->() { return client_; }
+
+	void discard() {				// connection unusable, delete rather than reuse
+	    pool.checkin( client_, false );
+	    client_ = nullptr;
+	} // uSocketClientPool::Lease::discard
+    }; // uSocketClientPool::Lease
+}; // uSocketClientPool
+
+
 // Local Variables: //
 // compile-command: "make install" //
 // End: //
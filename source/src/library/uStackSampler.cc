@@ -0,0 +1,325 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// uStackSampler.cc --
+//
+// Author           :
+// Created On       : Mon Oct 19 08:27:15 2026
+// Last Modified By :
+// Last Modified On : Mon Oct 19 08:27:15 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+
+#define __U_KERNEL__
+#include <uC++.h>
+#include <uStackSampler.h>
+
+//#include <uDebug.h>
+
+#include <cstdlib>					// free
+#include <cstring>					// strrchr
+#include <cstdio>					// snprintf
+#include <dlfcn.h>					// dladdr
+#include <cxxabi.h>					// __cxa_demangle
+#include <sys/time.h>					// setitimer
+
+
+#if defined( __i386__ )
+#define __U_SWITCH_RETURN__ 20				// uSwitch saves 8 bytes of control registers and 3 registers
+#elif defined( __x86_64__ )
+#define __U_SWITCH_RETURN__ 48				// uSwitch saves 8 bytes of control registers and 5 registers
+#else
+    #error uC++ : internal error, unsupported architecture
+#endif
+
+
+//######################### uStackSampler #########################
+
+
+uStackSampler *uStackSampler::active = nullptr;
+
+
+uStackSampler::uStackSampler( uDuration cpuPeriod, uDuration blockedPeriod ) :
+	cpuPeriod( cpuPeriod ), blockedPeriod( blockedPeriod ), wake( 0 ) {
+    if ( active != nullptr ) {
+	abort( "Attempt to create a uStackSampler while another sampler is active." );
+    } // if
+    assert( cpuPeriod.nanoseconds() >= 1000 && blockedPeriod.nanoseconds() > 0 ); // itimer resolution is microseconds
+
+    slots = new Sample[__U_STACK_SAMPLER_SLOTS__];
+    sweep = new Sample[__U_STACK_SAMPLER_SLOTS__];
+    for ( unsigned int i = 0; i < __U_STACK_SAMPLER_SLOTS__; i += 1 ) {
+	slots[i].state = Empty;
+    } // for
+    next = 0;
+    cpuSamples = blockedSamples = dropped_ = 0;
+    done = false;
+    lastSweep = uClock::currTime();
+
+    cluster = new uCluster( "uStackSampler" );
+    processor = new uProcessor( *cluster );
+    collector = new Collector( *cluster, *this );
+
+    active = this;
+    UPP::uSigHandlerModule::signal( SIGPROF, sigProfHandler, SA_SIGINFO | SA_RESTART );
+    long int usec = cpuPeriod.nanoseconds() / 1000;
+    struct itimerval it;
+    it.it_value.tv_sec = it.it_interval.tv_sec = usec / 1000000;
+    it.it_value.tv_usec = it.it_interval.tv_usec = usec % 1000000;
+    setitimer( ITIMER_PROF, &it, nullptr );		// process CPU time, delivered to a kernel thread using the CPU
+} // uStackSampler::uStackSampler
+
+
+uStackSampler::~uStackSampler() {
+    stop();
+    delete [] sweep;
+    delete [] slots;
+} // uStackSampler::~uStackSampler
+
+
+void uStackSampler::stop() {
+  if ( collector == nullptr ) return;			// already stopped ?
+    struct itimerval it = {};
+    setitimer( ITIMER_PROF, &it, nullptr );		// disarm timer
+    active = nullptr;					// pending SIGPROF ignored
+
+    done = true;
+    wake.V();
+    delete collector;					// wait for collector to finish
+    delete processor;
+    delete cluster;
+    collector = nullptr;
+    collect();						// samples written after collector's last pass
+} // uStackSampler::stop
+
+
+// Copy a bounded prefix of a task name without allocating, so it is usable in the signal handler.
+
+void uStackSampler::copyName( char *task, const char *name ) {
+    unsigned int i = 0;
+    if ( name != nullptr ) {
+	for ( ; i < __U_STACK_SAMPLER_NAME__ - 1 && name[i] != '\0'; i += 1 ) {
+	    task[i] = name[i];
+	} // for
+    } // if
+    task[i] = '\0';
+} // uStackSampler::copyName
+
+
+// Follow the frame-pointer chain, which must stay within the stack [limit, base) and move toward the base. A return
+// address is the instruction after the call, so one is subtracted to attribute the frame to the call instruction.
+
+unsigned int uStackSampler::walk( void *pc, void *fp, void *limit, void *base, void *pcs[] ) {
+    unsigned int depth = 0;
+    if ( pc != nullptr ) pcs[depth++] = pc;
+    void **frame = (void **)fp;
+
+    for ( ;; ) {
+      if ( depth == __U_STACK_SAMPLER_DEPTH__ ) break;
+      if ( (void *)frame < limit || (void *)(frame + 2) > base || ((uintptr_t)frame & (sizeof(void *) - 1)) != 0 ) break;
+	void *rtn = frame[1];
+      if ( rtn == nullptr ) break;
+	pcs[depth++] = (char *)rtn - 1;
+	void **prev = (void **)frame[0];
+      if ( prev <= frame ) break;			// outermost or corrupt frame
+	frame = prev;
+    } // for
+    return depth;
+} // uStackSampler::walk
+
+
+// The handler only copies the interrupted stack into a free slot, so it does not allocate or acquire locks. If the
+// collector has not emptied the slot, the sample is dropped.
+
+void uStackSampler::sigProfHandler( __U_SIGPARMS__ ) {
+    uStackSampler *sampler = active;
+  if ( sampler == nullptr ) return;			// stopping ?
+    Sample &sample = sampler->slots[uFetchAdd( sampler->next, 1 ) % __U_STACK_SAMPLER_SLOTS__];
+    if ( ! uCompareAssign( sample.state, (unsigned int)Empty, (unsigned int)Writing ) ) {
+	uFetchAdd( sampler->dropped_, 1 );
+	return;
+    } // if
+
+    uBaseTask &task = uThisTask();
+    UPP::uMachContext &stack = *task.currCoroutine;	// stack executing on the processor
+#if defined( __i386__ )
+    void *pc = (void *)cxt->uc_mcontext.gregs[REG_EIP], *fp = (void *)cxt->uc_mcontext.gregs[REG_EBP], *sp = (void *)cxt->uc_mcontext.gregs[REG_ESP];
+#else
+    void *pc = (void *)cxt->uc_mcontext.gregs[REG_RIP], *fp = (void *)cxt->uc_mcontext.gregs[REG_RBP], *sp = (void *)cxt->uc_mcontext.gregs[REG_RSP];
+#endif // __i386__
+
+    copyName( sample.task, task.getName() );
+    if ( stack.limit <= sp && sp < stack.base ) {	// on task stack, not processor kernel stack ?
+	sample.depth = walk( pc, fp, stack.limit, stack.base, sample.pcs );
+    } else {
+	sample.pcs[0] = pc;
+	sample.depth = 1;
+    } // if
+    __atomic_store_n( &sample.state, (unsigned int)Full, __ATOMIC_RELEASE );
+} // uStackSampler::sigProfHandler
+
+
+void uStackSampler::record( const Sample &sample, Kind kind, size_t usec ) {
+    Times &times = paths[Path( std::string( sample.task ), std::vector< void * >( sample.pcs, sample.pcs + sample.depth ) )]; // zero on insertion
+    if ( kind == Cpu ) {
+	times.cpu += usec;
+	cpuSamples += 1;
+    } else {
+	times.blocked += usec;
+	blockedSamples += 1;
+    } // if
+} // uStackSampler::record
+
+
+void uStackSampler::collect() {
+    size_t usec = cpuPeriod.nanoseconds() / 1000;	// CPU time represented by each sample
+
+    pathsLock.acquire();
+    for ( unsigned int i = 0; i < __U_STACK_SAMPLER_SLOTS__; i += 1 ) {
+	Sample &sample = slots[i];
+	if ( __atomic_load_n( &sample.state, __ATOMIC_ACQUIRE ) == Full ) {
+	    record( sample, Cpu, usec );
+	    __atomic_store_n( &sample.state, (unsigned int)Empty, __ATOMIC_RELEASE );
+	} // if
+    } // for
+    pathsLock.release();
+} // uStackSampler::collect
+
+
+// A blocked task cannot restart while its cluster's ready/idle lock is held, so its saved context and stack are stable.
+// Stacks are copied into the sweep buffer under the spin locks and recorded after they are released, because recording
+// allocates. To bound the time the scheduler is locked out, a cluster's lock is released after walking
+// __U_STACK_SAMPLER_HOLD__ frames and the sweep resumes after the tasks already examined; tasks added or removed in
+// the gap may be skipped or visited twice. Each blocked task is charged the time since the previous sweep.
+
+void uStackSampler::sweepBlocked() {
+    uTime now = uClock::currTime();
+    size_t usec = ( now - lastSweep ).nanoseconds() / 1000;
+    lastSweep = now;
+    unsigned int count = 0;
+
+    uKernelModule::globalClusterLock->acquire();
+    uClusterDL *cr;
+    for ( uSeqIter<uClusterDL> ci( *uKernelModule::globalClusters ); ci >> cr; ) {
+	uCluster &c = cr->cluster();
+	if ( &c == cluster ) continue;			// ignore sampler
+	unsigned int visited = 0;			// tasks examined on this cluster
+	for ( bool more = true; more; ) {
+	    more = false;
+	    unsigned int skip = visited, frames = 0;
+	    c.readyIdleTaskLock.acquire();
+	    uBaseTaskDL *bt;
+	    for ( uSeqIter<uBaseTaskDL> ti( c.tasksOnCluster ); ti >> bt; ) {
+		if ( skip > 0 ) {			// examined during a previous hold ?
+		    skip -= 1;
+		    continue;
+		} // if
+		if ( frames >= __U_STACK_SAMPLER_HOLD__ ) { // release lock and resume at this task
+		    more = true;
+		    break;
+		} // if
+		visited += 1;
+		uBaseTask &task = bt->task();
+		if ( task.getState() != uBaseTask::Blocked || (uProcessor *)(&task.bound) != nullptr || &task == uKernelModule::systemTask ) continue;
+		if ( count == __U_STACK_SAMPLER_SLOTS__ ) { // sweep buffer full ?
+		    uFetchAdd( dropped_, 1 );
+		    continue;
+		} // if
+		UPP::uMachContext &stack = *task.currCoroutine; // stack saved when task blocked
+		UPP::uMachContext::uContext_t &context = *(UPP::uMachContext::uContext_t *)stack.context;
+		void **sp = (void **)context.SP;
+		if ( (void *)sp < stack.limit || (void *)((char *)sp + __U_SWITCH_RETURN__ + sizeof(void *)) > stack.base ) continue;
+		Sample &sample = sweep[count];
+		count += 1;
+		copyName( sample.task, task.getName() );
+		void *rtn = *(void **)((char *)sp + __U_SWITCH_RETURN__); // return address from uSwitch
+		sample.depth = walk( (char *)rtn - 1, context.FP, stack.limit, stack.base, sample.pcs );
+		frames += sample.depth;
+	    } // for
+	    c.readyIdleTaskLock.release();
+	} // for
+    } // for
+    uKernelModule::globalClusterLock->release();
+
+    pathsLock.acquire();
+    for ( unsigned int i = 0; i < count; i += 1 ) {
+	record( sweep[i], Blocked, usec );
+    } // for
+    pathsLock.release();
+} // uStackSampler::sweepBlocked
+
+
+void uStackSampler::Collector::main() {
+    for ( ;; ) {
+	sampler.wake.P( sampler.blockedPeriod );
+	sampler.collect();
+      if ( sampler.done ) break;
+	sampler.sweepBlocked();
+    } // for
+} // uStackSampler::Collector::main
+
+
+// Name the function containing pc from the dynamic symbol tables, otherwise as module+offset or an address.
+
+static std::string uSymbolize( void *pc ) {
+    char buf[64];
+    Dl_info info;
+    if ( dladdr( pc, &info ) != 0 ) {
+	if ( info.dli_sname != nullptr ) {
+	    int status;
+	    char *demangled = abi::__cxa_demangle( info.dli_sname, nullptr, nullptr, &status );
+	    std::string name( status == 0 ? demangled : info.dli_sname );
+	    free( demangled );
+	    return name;
+	} // if
+	if ( info.dli_fname != nullptr ) {
+	    const char *module = strrchr( info.dli_fname, '/' );
+	    snprintf( buf, sizeof(buf), "+%#lx", (unsigned long int)((char *)pc - (char *)info.dli_fbase) );
+	    return std::string( module == nullptr ? info.dli_fname : module + 1 ) + buf;
+	} // if
+    } // if
+    snprintf( buf, sizeof(buf), "%p", pc );
+    return buf;
+} // uSymbolize
+
+
+void uStackSampler::folded( std::ostream &os, Kind kind ) {
+    std::map< void *, std::string > symbols;		// many paths share frames
+
+    collect();
+    pathsLock.acquire();
+    for ( std::map< Path, Times >::const_iterator p = paths.begin(); p != paths.end(); p ++ ) {
+	size_t usec = kind == Cpu ? p->second.cpu : p->second.blocked;
+	if ( usec == 0 ) continue;
+	os << p->first.first;
+	const std::vector< void * > &pcs = p->first.second;
+	for ( std::vector< void * >::const_reverse_iterator pc = pcs.rbegin(); pc != pcs.rend(); pc ++ ) {
+	    std::map< void *, std::string >::iterator s = symbols.find( *pc );
+	    if ( s == symbols.end() ) s = symbols.insert( std::make_pair( *pc, uSymbolize( *pc ) ) ).first;
+	    os << ';' << s->second;
+	} // for
+	os << ' ' << usec << '\n';
+    } // for
+    pathsLock.release();
+    os.flush();
+} // uStackSampler::folded
+
+
+// Local Variables: //
+// compile-command: "make install" //
+// End: //
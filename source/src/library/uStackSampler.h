@@ -0,0 +1,133 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// uStackSampler.h -- on-CPU and off-CPU call-stack sampling of tasks for flame graphs
+//
+// Author           :
+// Created On       : Mon Oct 19 08:27:15 2026
+// Last Modified By :
+// Last Modified On : Mon Oct 19 08:27:15 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+
+#pragma once
+
+
+#include <ostream>
+#include <map>
+#include <string>
+#include <vector>
+#include <uSemaphore.h>
+
+
+#define __U_STACK_SAMPLER_DEPTH__ 64			// maximum frames recorded per sample
+#define __U_STACK_SAMPLER_SLOTS__ 4096			// samples buffered between collections
+#define __U_STACK_SAMPLER_NAME__ 64			// maximum task-name characters recorded per sample
+#define __U_STACK_SAMPLER_HOLD__ 1024			// maximum frames walked per hold of a cluster's task lock
+
+
+// A uStackSampler attributes time to the call paths of uC++ tasks. On-CPU time is sampled by a SIGPROF process CPU
+// timer, which the operating system delivers to the kernel thread (processor) consuming CPU time; the handler records
+// the stack of the task running on that processor into a fixed buffer. Off-CPU time is sampled by a collector task,
+// executing on its own cluster and processor, which periodically walks the saved context of every blocked task. Time
+// is accumulated per task name and call path, separately for CPU and blocked time, and written in the folded-stack
+// format read by flame-graph tools, e.g.:
+//
+//    uStackSampler sampler;
+//    ... workload ...
+//    sampler.stop();
+//    sampler.folded( cpuFile, uStackSampler::Cpu );
+//    sampler.folded( blockedFile, uStackSampler::Blocked );
+//
+// Stacks are followed through frame pointers, so code must be compiled with -fno-omit-frame-pointer for complete call
+// paths, and linked with -rdynamic for function names of the executable; otherwise paths are truncated or frames are
+// printed as module+offset. Samples are approximate: a task blocking or unblocking during a sweep may be skipped or
+// recorded with a partial stack. Only one sampler may be active at a time.
+
+class uStackSampler {
+  public:
+    enum Kind { Cpu, Blocked };
+  private:
+    enum { Empty, Writing, Full };			// sample slot states
+
+    struct Sample {
+	volatile unsigned int state;
+	unsigned int depth;
+	char task[__U_STACK_SAMPLER_NAME__];		// task name prefix, copied as the task may be deleted
+	void *pcs[__U_STACK_SAMPLER_DEPTH__];		// innermost first
+    }; // Sample
+
+    struct Times {
+	size_t cpu, blocked;				// microseconds
+    }; // Times
+
+    typedef std::pair< std::string, std::vector< void * > > Path; // task name, pcs innermost first
+
+    _Task Collector {
+	uStackSampler &sampler;
+
+	void main();
+      public:
+	Collector( uCluster &cluster, uStackSampler &sampler ) : uBaseTask( cluster ), sampler( sampler ) {}
+    }; // Collector
+
+    static uStackSampler *active;			// target of SIGPROF handler
+
+    const uDuration cpuPeriod, blockedPeriod;
+    Sample *slots;					// on-CPU samples written by SIGPROF handler
+    Sample *sweep;					// off-CPU samples copied from blocked tasks
+    volatile unsigned int next;				// next slot, modulo __U_STACK_SAMPLER_SLOTS__
+    uTime lastSweep;
+    uCluster *cluster;					// collector does not use processors of sampled tasks
+    uProcessor *processor;
+    Collector *collector;
+    uSemaphore wake;
+    volatile bool done;
+
+    uOwnerLock pathsLock;				// protects paths
+    std::map< Path, Times > paths;
+
+    volatile size_t cpuSamples, blockedSamples, dropped_;
+
+    static void sigProfHandler( __U_SIGPARMS__ );
+    static void copyName( char *task, const char *name );
+    static unsigned int walk( void *pc, void *fp, void *limit, void *base, void *pcs[] );
+    void record( const Sample &sample, Kind kind, size_t usec );
+    void collect();
+    void sweepBlocked();
+  public:
+    uStackSampler( const uStackSampler & ) = delete;	// no copy
+    uStackSampler( uStackSampler && ) = delete;
+    uStackSampler &operator=( const uStackSampler & ) = delete; // no assignment
+
+    uStackSampler( uDuration cpuPeriod = uDuration( 0, 10000000 ), uDuration blockedPeriod = uDuration( 0, 10000000 ) );
+    ~uStackSampler();
+
+    void stop();					// stop sampling, implicit in destructor
+
+    // Write one line per call path, "task;outermost;...;innermost microseconds", for CPU or blocked time.
+    void folded( std::ostream &os, Kind kind );
+
+    size_t samples( Kind kind ) const { return kind == Cpu ? cpuSamples : blockedSamples; }
+    size_t dropped() const { return dropped_; }		// samples lost to a full buffer
+}; // uStackSampler
+
+
+// Local Variables: //
+// compile-command: "make install" //
+// End: //
@@ -100,6 +100,7 @@ void uDeadlineMonotonic1::addInitialize( uSequence<uBaseTaskDL> &taskList ) {
 	num_priorities += 1;
 	if ( num_priorities <= __U_MAX_NUMBER_PRIORITIES__ ) {
 	    objects[num_priorities - 1].priority = tpri;
+	    rankQueues();				// new level may fall between existing levels
 	    setBaseQueue( task, num_priorities - 1 );
 	    if ( queueNum == -1 ) {
 		setActiveQueue( task, num_priorities - 1 ); // should have at least t's serial on queue by now
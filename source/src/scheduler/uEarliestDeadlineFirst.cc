@@ -0,0 +1,180 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// uEarliestDeadlineFirst.cc --
+//
+// Author           :
+// Created On       : Sun Oct 18 12:14:40 2026
+// Last Modified By :
+// Last Modified On : Sun Oct 18 12:14:40 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+
+#define __U_KERNEL__
+#include <uC++.h>
+#include <uEarliestDeadlineFirst.h>
+
+//#include <uDebug.h>
+
+
+uEarliestDeadlineFirst::uEarliestDeadlineFirst() {
+    jobs = misses = postponements = 0;
+} // uEarliestDeadlineFirst::uEarliestDeadlineFirst
+
+
+// A task becoming ready at or after its next release time starts a new job; otherwise it is the current job resuming
+// after preemption or blocking. The previous job completed when the task last switched out, so a miss is charged if
+// that is after the job's deadline. The minimum separation between jobs is the period or frame; an aperiodic task
+// starts a new job once its deadline passes. A zero deadline means the deadline equals the period or frame.
+
+void uEarliestDeadlineFirst::release( uRealTimeBaseTask &task, int kind, uTime now ) {
+    uSporadicBaseTask *stask = kind == Server ? static_cast<uSporadicBaseTask *>(&task) : nullptr;
+    uDuration interval = kind == Periodic ? static_cast<uPeriodicBaseTask &>(task).getPeriod()
+	: stask != nullptr ? stask->getFrame() : task.getDeadline();
+    uDuration deadline = task.getDeadline() != 0 ? task.getDeadline() : interval;
+
+    if ( task.jobs != 0 && ! task.missed && getSwitchOut( task ) > task.release + deadline ) {
+	misses += 1;
+	task.misses += 1;
+    } // if
+    jobs += 1;
+    task.jobs += 1;
+    task.missed = false;
+    task.release = now;
+    task.nextRelease = now + interval;
+
+    if ( stask != nullptr && stask->budget != 0 ) {	// constant-bandwidth server
+	// Keep the current server deadline if the remaining budget can be consumed by then without exceeding the
+	// server bandwidth, otherwise replenish the budget with a new deadline.
+	double left = (double)(task.absDeadline - now).nanoseconds() * stask->budget.nanoseconds() / stask->frame.nanoseconds();
+	if ( task.absDeadline <= now || (double)stask->remaining.nanoseconds() >= left ) {
+	    stask->remaining = stask->budget;
+	    task.absDeadline = now + stask->frame;
+	} // if
+    } else {
+	task.absDeadline = now + deadline;
+    } // if
+} // uEarliestDeadlineFirst::release
+
+
+// Charge a server for execution since it was last charged. Each exhausted budget is replenished and the server deadline
+// postponed by a frame, lowering the task's priority instead of letting it overrun.
+
+void uEarliestDeadlineFirst::charge( uSporadicBaseTask &task ) {
+    uDuration exec = uBaseTask::cpuDuration( getExecutionTicks( task ) );
+    task.remaining -= exec - task.serverCharged;
+    task.serverCharged = exec;
+    while ( task.remaining <= 0 ) {
+	task.remaining += task.budget;
+	task.absDeadline = task.absDeadline + task.frame;
+	postponements += 1;
+    } // while
+} // uEarliestDeadlineFirst::charge
+
+
+void uEarliestDeadlineFirst::insert( uBaseTaskDL *node ) {
+    uTime deadline = rtask( node ).absDeadline;
+    uBaseTaskDL *aft;
+    // search from the tail as new jobs usually have the latest deadlines; equal deadlines are FIFO
+    for ( aft = ready.tail(); aft != nullptr && rtask( aft ).absDeadline > deadline; aft = ready.pred( aft ) );
+    ready.insertAft( aft, node );
+} // uEarliestDeadlineFirst::insert
+
+
+bool uEarliestDeadlineFirst::empty() const {
+    return ready.empty() && background.empty();
+} // uEarliestDeadlineFirst::empty
+
+
+void uEarliestDeadlineFirst::add( uBaseTaskDL *node ) {
+    uBaseTask &task = node->task();
+    int kind = getBaseQueue( task );
+  if ( kind == Background ) { background.addTail( node ); return; }
+
+    uRealTimeBaseTask &rt = static_cast<uRealTimeBaseTask &>(task);
+    uTime now = uClock::currTime();
+    if ( kind == Server && static_cast<uSporadicBaseTask &>(task).budget != 0 ) {
+	charge( static_cast<uSporadicBaseTask &>(task) );
+    } // if
+    if ( now >= rt.nextRelease ) {
+	release( rt, kind, now );
+    } else if ( ! rt.missed && now > rt.release + (rt.getDeadline() != 0 ? rt.getDeadline() : rt.nextRelease - rt.release) ) {
+	rt.missed = true;				// current job still running after its deadline
+	misses += 1;
+	rt.misses += 1;
+    } // if
+    insert( node );
+} // uEarliestDeadlineFirst::add
+
+
+uBaseTaskDL *uEarliestDeadlineFirst::drop() {
+    uBaseTaskDL *node = ready.dropHead();
+    if ( node == nullptr ) node = background.dropHead();
+    return node;
+} // uEarliestDeadlineFirst::drop
+
+
+void uEarliestDeadlineFirst::remove( uBaseTaskDL *node ) {
+    if ( getBaseQueue( node->task() ) == Background ) {
+	background.remove( node );
+    } else {
+	ready.remove( node );
+    } // if
+} // uEarliestDeadlineFirst::remove
+
+
+void uEarliestDeadlineFirst::transfer( uBaseTaskSeq &from ) {
+    while ( ! from.empty() ) {
+	add( from.dropHead() );
+    } // while
+} // uEarliestDeadlineFirst::transfer
+
+
+// Deadlines are not inherited through monitors; a monitor shared by real-time tasks should use a ceiling protocol.
+
+bool uEarliestDeadlineFirst::checkPriority( uBaseTaskDL &, uBaseTaskDL & ) { return false; }
+
+void uEarliestDeadlineFirst::resetPriority( uBaseTaskDL &, uBaseTaskDL & ) {}
+
+
+// The kernel adds a new task to the end of the cluster's task list. Classify it once so ready-queue operations need no
+// dynamic casts.
+
+void uEarliestDeadlineFirst::addInitialize( uBaseTaskSeq &taskList ) {
+    uBaseTask &task = taskList.tail()->task();
+    if ( dynamic_cast<uSporadicBaseTask *>(&task) != nullptr ) {
+	setBaseQueue( task, Server );
+    } else if ( dynamic_cast<uPeriodicBaseTask *>(&task) != nullptr ) {
+	setBaseQueue( task, Periodic );
+    } else if ( dynamic_cast<uRealTimeBaseTask *>(&task) != nullptr ) {
+	setBaseQueue( task, RealTime );
+    } else {
+	setBaseQueue( task, Background );
+    } // if
+} // uEarliestDeadlineFirst::addInitialize
+
+void uEarliestDeadlineFirst::removeInitialize( uBaseTaskSeq & ) {}
+
+// A changed deadline, period or frame takes effect at the task's next job.
+
+void uEarliestDeadlineFirst::rescheduleTask( uBaseTaskDL *, uBaseTaskSeq & ) {}
+
+
+// Local Variables: //
+// compile-command: "make install" //
+// End: //
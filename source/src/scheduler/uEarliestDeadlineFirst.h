@@ -0,0 +1,76 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// uEarliestDeadlineFirst.h --
+//
+// Author           :
+// Created On       : Sun Oct 18 12:14:40 2026
+// Last Modified By :
+// Last Modified On : Sun Oct 18 12:14:40 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+
+#pragma once
+
+
+#include <uC++.h>
+#include <uRealTime.h>
+
+
+// Earliest-deadline-first ready queue. Real-time tasks are ordered by the absolute deadline of their current job;
+// non-real-time tasks run in FIFO order when no real-time task is ready. A sporadic task with a budget is served by a
+// constant-bandwidth server, which postpones the task's scheduling deadline by a frame each time the budget is
+// consumed, so an overrunning task cannot take more than budget/frame of a processor from other tasks. Job
+// releases, deadline misses and budget consumption are observed when tasks enter the ready queue.
+
+class uEarliestDeadlineFirst : public uBaseSchedule<uBaseTaskDL> {
+    enum Kind { Background, RealTime, Periodic, Server };		// kept in the task's base queue
+
+    uBaseTaskSeq ready;					// real-time tasks in deadline order
+    uBaseTaskSeq background;				// non-real-time tasks
+    unsigned int jobs, misses, postponements;
+
+    static uRealTimeBaseTask &rtask( uBaseTaskDL *node ) {
+	return static_cast<uRealTimeBaseTask &>(node->task());
+    } // uEarliestDeadlineFirst::rtask
+
+    void release( uRealTimeBaseTask &task, int kind, uTime now );
+    void charge( uSporadicBaseTask &task );
+    void insert( uBaseTaskDL *node );
+  public:
+    uEarliestDeadlineFirst();
+    bool empty() const;
+    void add( uBaseTaskDL *node );
+    uBaseTaskDL *drop();
+    void remove( uBaseTaskDL *node );
+    void transfer( uBaseTaskSeq &from );
+    bool checkPriority( uBaseTaskDL &owner, uBaseTaskDL &calling );
+    void resetPriority( uBaseTaskDL &owner, uBaseTaskDL &calling );
+    void addInitialize( uBaseTaskSeq &taskList );
+    void removeInitialize( uBaseTaskSeq &taskList );
+    void rescheduleTask( uBaseTaskDL *taskNode, uBaseTaskSeq &taskList );
+
+    unsigned int getJobs() const { return jobs; }
+    unsigned int getDeadlineMisses() const { return misses; }
+    unsigned int getPostponements() const { return postponements; }
+}; // uEarliestDeadlineFirst
+
+
+// Local Variables: //
+// compile-command: "make install" //
+// End: //
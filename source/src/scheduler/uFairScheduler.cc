@@ -0,0 +1,115 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// uFairScheduler.cc --
+//
+// Author           :
+// Created On       : Sun Oct 18 19:12:26 2026
+// Last Modified By :
+// Last Modified On : Sun Oct 18 19:12:26 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+
+#define __U_KERNEL__
+#include <uC++.h>
+#include <uFairScheduler.h>
+
+//#include <uDebug.h>
+
+
+const uDuration uFairScheduler::Slack( 0, 1000000 );	// 1 millisecond
+
+
+uFairScheduler::uFairScheduler() {
+    tickets = minVirtualTime = 0;
+} // uFairScheduler::uFairScheduler
+
+
+// Add the time executed since the task was last charged. The task is not running, so its execution ticks are stable.
+// Only the ticks since the last charge are converted, so the virtual time never decreases.
+
+void uFairScheduler::charge( uBaseTask &task ) {
+    unsigned long long int ticks = getExecutionTicks( task );
+    virtualTime( task ) += uBaseTask::cpuDuration( ticks - chargedTicks( task ) ).nanoseconds() * uBaseTask::DefaultWeight / task.getWeight();
+    chargedTicks( task ) = ticks;
+    unsigned long long int slack = Slack.nanoseconds();
+    if ( virtualTime( task ) + slack < minVirtualTime ) { // blocked for a long time ?
+	virtualTime( task ) = minVirtualTime - slack;
+    } // if
+} // uFairScheduler::charge
+
+
+bool uFairScheduler::empty() const {
+    return heap.empty();
+} // uFairScheduler::empty
+
+
+void uFairScheduler::add( uBaseTaskDL *node ) {
+    uBaseTask &task = node->task();
+    charge( task );
+    Key key = { virtualTime( task ), tickets };
+    tickets += 1;
+    heap.insert( key, node );
+} // uFairScheduler::add
+
+
+uBaseTaskDL *uFairScheduler::drop() {
+  if ( heap.empty() ) return nullptr;
+    uBaseTaskDL *node = heap.root().data;
+    heap.deleteRoot();
+    if ( virtualTime( node->task() ) > minVirtualTime ) {
+	minVirtualTime = virtualTime( node->task() );
+    } // if
+    return node;
+} // uFairScheduler::drop
+
+
+void uFairScheduler::remove( uBaseTaskDL *node ) {
+    heap.remove( readyIndex( node->task() ) );
+} // uFairScheduler::remove
+
+
+void uFairScheduler::transfer( uBaseTaskSeq &from ) {
+    while ( ! from.empty() ) {
+	add( from.dropHead() );
+    } // while
+} // uFairScheduler::transfer
+
+
+bool uFairScheduler::checkPriority( uBaseTaskDL &, uBaseTaskDL & ) { return false; }
+
+void uFairScheduler::resetPriority( uBaseTaskDL &, uBaseTaskDL & ) {}
+
+
+// The kernel adds a new task to the end of the cluster's task list. A migrating task keeps its execution time but
+// restarts at this cluster's virtual time.
+
+void uFairScheduler::addInitialize( uBaseTaskSeq &taskList ) {
+    uBaseTask &task = taskList.tail()->task();
+    virtualTime( task ) = minVirtualTime;
+    chargedTicks( task ) = getExecutionTicks( task );
+} // uFairScheduler::addInitialize
+
+void uFairScheduler::removeInitialize( uBaseTaskSeq & ) {}
+
+void uFairScheduler::rescheduleTask( uBaseTaskDL *, uBaseTaskSeq & ) {}
+
+
+// Local Variables: //
+// compile-command: "make install" //
+// End: //
@@ -0,0 +1,82 @@
+//                              -*- Mode: C++ -*-
+//
+// uC++ Version 7.0.0, Copyright (C) Peter A. Buhr 2026
+//
+// uFairScheduler.h --
+//
+// Author           :
+// Created On       : Sun Oct 18 19:12:26 2026
+// Last Modified By :
+// Last Modified On : Sun Oct 18 19:12:26 2026
+// Update Count     : 1
+//
+// This  library is free  software; you  can redistribute  it and/or  modify it
+// under the terms of the GNU Lesser General Public License as published by the
+// Free Software  Foundation; either  version 2.1 of  the License, or  (at your
+// option) any later version.
+//
+// This library is distributed in the  hope that it will be useful, but WITHOUT
+// ANY  WARRANTY;  without even  the  implied  warranty  of MERCHANTABILITY  or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should  have received a  copy of the  GNU Lesser General  Public License
+// along  with this library.
+//
+
+
+#pragma once
+
+
+#include <uC++.h>
+#include <uHeap.h>
+#include <uFlexArray.h>
+
+
+// Fair-share ready queue. Each task has a virtual time, in nanoseconds, advanced by its execution time scaled by
+// DefaultWeight / weight, and the task with the smallest virtual time runs next, so a task with twice the weight gets
+// twice the processor when both are ready. A task that blocked for a long time resumes at most Slack behind the
+// smallest virtual time, so it runs promptly but cannot monopolize the processors to catch up. A new task starts at the
+// smallest virtual time. Ready tasks are kept in a d-ary heap, so adding or selecting a task is logarithmic in the
+// number of ready tasks; tasks with equal virtual times are selected in the order they became ready.
+
+class uFairScheduler : public uBaseSchedule<uBaseTaskDL> {
+    static const uDuration Slack;			// virtual-time credit for a waking task
+
+    struct Key {
+	unsigned long long int vtime, ticket;		// ticket orders equal virtual times FIFO
+
+	bool operator<( const Key &k ) const {
+	    return vtime < k.vtime || ( vtime == k.vtime && ticket < k.ticket );
+	} // Key::operator<
+    }; // Key
+
+    struct Index {					// record heap subscript of a task as it moves
+	static void moved( uHeapable<Key, uBaseTaskDL *> &elem, int index ) { readyIndex( elem.data->task() ) = index; }
+    }; // Index
+
+    uDynamicDaryHeap<Key, uBaseTaskDL *, uHeapMin<Key>, Index> heap; // smallest virtual time at root
+    unsigned long long int tickets;			// next FIFO ticket
+    unsigned long long int minVirtualTime;		// virtual time (nanoseconds) of last task selected, never decreases
+
+    void charge( uBaseTask &task );
+  public:
+    uFairScheduler();
+    bool empty() const;
+    void add( uBaseTaskDL *node );
+    uBaseTaskDL *drop();
+    void remove( uBaseTaskDL *node );
+    void transfer( uBaseTaskSeq &from );
+    bool checkPriority( uBaseTaskDL &owner, uBaseTaskDL &calling );
+    void resetPriority( uBaseTaskDL &owner, uBaseTaskDL &calling );
+    void addInitialize( uBaseTaskSeq &taskList );
+    void removeInitialize( uBaseTaskSeq &taskList );
+    void rescheduleTask( uBaseTaskDL *taskNode, uBaseTaskSeq &taskList );
+
+    unsigned long long int getMinVirtualTime() const { return minVirtualTime; }
+}; // uFairScheduler
+
+
+// Local Variables: //
+// compile-command: "make install" //
+// End: //
@@ -33,32 +33,7 @@
 #define uLockAcquired  0
 #define uLockReleased  1
 
-// compare for Heapify property, ie parent(i) <= i
-int uPriorityQ::compare( int k1, int k2 ) {
-    if ( k1 < k2 ) {
-	return 1;
-    } else if ( k1 == k2 ){
-	return 0;
-    } else {
-	return -1;
-    } // if
-} // compare
-
-
-void uPriorityQ::exchange( uHeapable<int, uHeapBaseSeq *> &x, uHeapable<int, uHeapBaseSeq *> &y ) {
-    uHeapable<int, uHeapBaseSeq *> temp = x;
-    int t_index = x.data->index;
-    x = y;
-    y = temp;
-    y.data->index = x.data->index;			// swapping locations requires the index pointers to be updated
-    x.data->index = t_index;
-#ifdef DEBUG_SHOW_COUNT
-    NumExchg += 1;
-#endif
-} // uPriorityQ::exchange
-
-
-uPriorityQ::uPriorityQ() : heap( &compare, &exchange ) {
+uPriorityQ::uPriorityQ() {
     //for ( int i = 0; i < __U_MAX_NUMBER_PRIORITIES__ ; i += 1 ) {
     //    heap.A[i + 1].data = &(objects[i]);
     //} // for
@@ -110,9 +85,7 @@ int uPriorityQ::add( uBaseTaskDL *node, uBaseTask *owner ) {
     // if empty then must add to heap, otherwise just insert node
     if ( objects[queueNum].queue.empty() ) {
 	objects[queueNum].queue.add(node);
-	// the index must be set before inserting because the index can change as part of the insert
-	objects[queueNum].index = heap.size() + 1;
- 	heap.insert( priority, &(objects[queueNum]) );
+	heap.insert( priority, &(objects[queueNum]) );	// sets index
     } else {
 	objects[queueNum].queue.add(node);
     } // if
@@ -152,7 +125,7 @@ void uPriorityQ::remove( uBaseTaskDL *node ) {
 
     // if empty then must remove from heap
     if ( objects[queueNum].queue.empty() ) {
-	heap.deletenode( heap.A[objects[queueNum].index] );
+	heap.remove( objects[queueNum].index );
     } // if
 } // uPriorityQ::remove
 
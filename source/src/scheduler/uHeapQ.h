@@ -45,14 +45,16 @@ class uPriorityQ : public uBasePrioritySeq {
 	uBaseTaskSeq queue;
     };
 
+    struct Index {					// record heap subscript of a level as it moves
+	static void moved( uHeapable<int, uHeapBaseSeq *> &elem, int index ) { elem.data->index = index; }
+    }; // Index
+
     uHeapBaseSeq objects[__U_MAX_NUMBER_PRIORITIES__ ];
-    uHeap<int, uHeapBaseSeq *, __U_MAX_NUMBER_PRIORITIES__> heap;
+    uStaticDaryHeap<int, uHeapBaseSeq *, __U_MAX_NUMBER_PRIORITIES__, uHeapMin<int>, Index> heap; // smallest value => highest priority
 
     int currPriority;
     int currQueueNum;
 
-    static int compare(int k1, int k2);
-    static void exchange( uHeapable<int, uHeapBaseSeq *> &x, uHeapable<int, uHeapBaseSeq *> &y );
   public:
     uPriorityQ();
     virtual bool empty() const;
@@ -72,58 +74,87 @@ class uPriorityQ : public uBasePrioritySeq {
 }; // PriorityQ
 
 
+// Non-empty priority levels are recorded in a two-level bitmap indexed by the rank of a level's priority, so finding
+// the highest-priority level is two find-first-set operations independent of the number of levels. Lower priority
+// values have lower ranks and are scheduled first.
+
 template<typename List, typename Node> class uPriorityScheduleQ : public uBaseSchedule<Node> {
+    enum { Bits = sizeof(unsigned long) * 8, Words = (__U_MAX_NUMBER_PRIORITIES__ + Bits - 1) / Bits };
+    static_assert( Words <= Bits, "__U_MAX_NUMBER_PRIORITIES__ exceeds two-level bitmap" );
+
     struct uHeapScheduleSeq {
 	int priority;
-	int index;
+	int rank;					// position of priority among levels
 	List queue;
     };
 
-    // compare for Heapify property, ie parent(i) <= i
-    static int compare( int k1, int k2 ) {
-	if ( k1 < k2 ) {
-	    return 1;
-	} else if ( k1 == k2 ){
-	    return 0;
-	} else {
-	    return -1;
-	}
-    } // compare
-
-    static void exchange( uHeapable<int, uHeapScheduleSeq *> &x, uHeapable<int, uHeapScheduleSeq *> &y ) {
-	uHeapable<int, uHeapScheduleSeq *> temp = x;
-	int t_index = x.data->index;
-	x = y;
-	y = temp;
-	y.data->index = x.data->index;			// swapping locations requires the index pointers to be updated
-	x.data->index = t_index;
-#ifdef DEBUG_SHOW_COUNT
-	NumExchg += 1;
-#endif
-    } // exchange
+    unsigned long summary;				// bit w set => words[w] != 0
+    unsigned long words[Words];				// bit r set => level with rank r non-empty
+    int order[__U_MAX_NUMBER_PRIORITIES__];		// rank => queue number
+
+    void set( int rank ) {
+	words[rank / Bits] |= 1ul << (rank % Bits);
+	summary |= 1ul << (rank / Bits);
+    } // set
+
+    void clear( int rank ) {
+	unsigned long &word = words[rank / Bits];
+	word &= ~(1ul << (rank % Bits));
+	if ( word == 0 ) summary &= ~(1ul << (rank / Bits));
+    } // clear
+
+    int first() const {					// highest non-empty level, queue must be non-empty
+	int w = __builtin_ctzl( summary );
+	return order[w * Bits + __builtin_ctzl( words[w] )];
+    } // first
   protected:
     using uBaseSchedule<Node>::getActiveQueueValue;
 
     uHeapScheduleSeq objects[ __U_MAX_NUMBER_PRIORITIES__ ];
-    uHeap<int, uHeapScheduleSeq *, __U_MAX_NUMBER_PRIORITIES__> heap;
     unsigned int verCount;
     int num_priorities;
+
+    // Must be called after objects[].priority or num_priorities change. Levels are few and priorities only change
+    // when tasks are initialized, so a sort here keeps add/drop constant time.
+    void rankQueues() {
+	for ( int i = 0; i < num_priorities; i += 1 ) {	// insertion sort queue numbers by priority
+	    int j;
+	    for ( j = i; j > 0 && objects[order[j - 1]].priority > objects[i].priority; j -= 1 ) {
+		order[j] = order[j - 1];
+	    } // for
+	    order[j] = i;
+	} // for
+	summary = 0;					// rebuild bitmap with new ranks
+	for ( int w = 0; w < Words; w += 1 ) words[w] = 0;
+	for ( int r = 0; r < num_priorities; r += 1 ) {
+	    objects[order[r]].rank = r;
+	    if ( ! objects[order[r]].queue.empty() ) set( r );
+	} // for
+    } // rankQueues
+
+    void removeNode( Node *node ) {
+	int queueNum = getActiveQueueValue( node->task() ); // use the node for you active priority
+
+	objects[queueNum].queue.remove( node );
+	if ( objects[queueNum].queue.empty() ) {
+	    clear( objects[queueNum].rank );
+	} // if
+    } // uPriorityScheduleQ::removeNode
   public:
-    uPriorityScheduleQ() : heap( &compare, &exchange ) {
+    uPriorityScheduleQ() {
 	verCount = 0;
 	num_priorities = 1;				// first is always non-real-time tasks
 	objects[0].priority = INT_MAX;			// use a large number, syn which addInitialize
+	rankQueues();
     } // uPriorityScheduleQ::uPriorityScheduleQ
 
     virtual bool empty() const {
-	return heap.size() == 0;
+	return summary == 0;
     } // uPriorityScheduleQ::empty
 
     virtual Node *head() const {
 	if ( ! empty() ) {
-	    uHeapable<int, uHeapScheduleSeq *> rqueue;
-	    heap.getRoot( rqueue );
-	    return rqueue.data->queue.head();
+	    return objects[first()].queue.head();
 	} else {
 	    return nullptr;
 	} // if
@@ -132,25 +163,20 @@ template<typename List, typename Node> class uPriorityScheduleQ : public uBaseSc
     virtual void add( Node *node ) {
 	int queueNum = getActiveQueueValue( node->task() ); // use the node for you active priority
 
-	// if empty then must add to heap, otherwise just insert node
+	// if empty then must mark level non-empty, otherwise just insert node
 	if ( objects[queueNum].queue.empty() ) {
-	    objects[queueNum].queue.add(node);
-	    // the index must be set before inserting because the index can change as part of the insert
-	    objects[queueNum].index = heap.size() + 1;
-	    heap.insert( objects[queueNum].priority, &(objects[queueNum]) );
-	} else {
-	    objects[queueNum].queue.add(node);
+	    set( objects[queueNum].rank );
 	} // if
+	objects[queueNum].queue.add( node );
     } // uPriorityScheduleQ::add
 
     virtual Node *drop() {
 	if ( ! empty() ) {
-	    uHeapable<int, uHeapScheduleSeq *> rqueue;
-	    heap.getRoot( rqueue );
-	    Node *pnode = rqueue.data->queue.drop();
+	    uHeapScheduleSeq &level = objects[first()];
+	    Node *pnode = level.queue.drop();
 
-	    if ( rqueue.data->queue.empty() ){
-		heap.deleteRoot();
+	    if ( level.queue.empty() ) {
+		clear( level.rank );
 	    } // if
 	    return pnode;
 	} else {
@@ -181,7 +207,7 @@ template<typename List, typename Node> class uPriorityScheduleQSeq : public uPri
     using uPriorityScheduleQ<List, Node>::objects;
     using uPriorityScheduleQ<List, Node>::setActivePriority;
     using uPriorityScheduleQ<List, Node>::setActiveQueue;
-    using uPriorityScheduleQ<List, Node>::heap;
+    using uPriorityScheduleQ<List, Node>::removeNode;
     using uPriorityScheduleQ<List, Node>::getActivePriorityValue;
     using uPriorityScheduleQ<List, Node>::getActiveQueueValue;
     using uPriorityScheduleQ<List, Node>::add;
@@ -218,14 +244,7 @@ template<typename List, typename Node> class uPriorityScheduleQSeq : public uPri
     } // uPriorityScheduleQSeq::resetPriority
 
     virtual void remove( Node *node ) {
-	int queueNum = getActiveQueueValue( node->task() ); // use the node for you active priority
-
-	// do remove
-	objects[queueNum].queue.remove(node);
-	// if empty then must remove from heap
-	if ( objects[queueNum].queue.empty() ) {
-	    heap.deletenode( heap.A[objects[queueNum].index] );
-	}
+	removeNode( node );
     } // uPriorityScheduleQSeq::remove
 
     virtual void transfer( uBaseTaskSeq & /* from */ ) {
@@ -31,32 +31,7 @@
 //#include <uDebug.h>
 
 
-// compare for Heapify property, ie parent(i) <= i
-int uPIHeap::compare( int k1, int k2 ) {
-    if ( k1 < k2 ) {
-	return 1;
-    } else if ( k1 == k2 ){
-	return 0;
-    } else {
-	return -1;
-    } // if
-} // compare
-
-
-void uPIHeap::exchange( uHeapable<int, uHeapBaseSeq *> &x, uHeapable<int, uHeapBaseSeq *> &y ) {
-    uHeapable<int, uHeapBaseSeq *> temp = x;
-    int t_index = x.data->index;
-    x = y;
-    y = temp;
-    y.data->index = x.data->index;			// swapping locations requires the index pointers to be updated
-    x.data->index = t_index;
-#ifdef DEBUG_SHOW_COUNT
-    NumExchg += 1;
-#endif
-} // uHeap::exchange
-
-
-uPIHeap::uPIHeap() : heap( &compare, &exchange ) {
+uPIHeap::uPIHeap() {
     for ( int i = 0; i < __U_MAX_NUMBER_PRIORITIES__ ; i += 1 ) {
 	objects[i].count = 0;
     } // for
@@ -111,9 +86,7 @@ void uPIHeap::add( int priority, int queueNum ) {
 
     // if empty then must add to heap, otherwise just insert node
     if ( objects[queueNum].count == 0 ) {
-	// the index must be set before inserting because the index can change as part of the insert
-	objects[queueNum].index = heap.size() + 1;
-	heap.insert( priority, &(objects[queueNum]) );
+	heap.insert( priority, &(objects[queueNum]) );	// sets index
     } // if
     //objects[queueNum].queue.add(node);
     objects[queueNum].count += 1;
@@ -161,7 +134,7 @@ void uPIHeap::remove( int /* priority */, int queueNum ) {
 
     // if empty then must remove from heap
     if ( objects[queueNum].count == 0 ) {
-	heap.deletenode( heap.A[objects[queueNum].index] );
+	heap.remove( objects[queueNum].index );
     } // if
 
     lock.release();
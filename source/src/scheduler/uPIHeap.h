@@ -44,12 +44,13 @@ class uPIHeap : public uBasePIQ {
 	//uBaseTaskSeq queue;
     };
 
+    struct Index {					// record heap subscript of a level as it moves
+	static void moved( uHeapable<int, uHeapBaseSeq *> &elem, int index ) { elem.data->index = index; }
+    }; // Index
+
     uHeapBaseSeq objects[ __U_MAX_NUMBER_PRIORITIES__ ];
-    uHeap<int, uHeapBaseSeq *, __U_MAX_NUMBER_PRIORITIES__> heap;
+    uStaticDaryHeap<int, uHeapBaseSeq *, __U_MAX_NUMBER_PRIORITIES__, uHeapMin<int>, Index> heap; // smallest value => highest priority
     uSpinLock lock;
-
-    static int compare(int k1, int k2);
-    static void exchange( uHeapable<int, uHeapBaseSeq *> &x, uHeapable<int, uHeapBaseSeq *> &y );
   public:
     uPIHeap();
     virtual bool empty() const;
@@ -33,7 +33,15 @@
 //######################### uRealTimeBaseTask #########################
 
 
-uRealTimeBaseTask::uRealTimeBaseTask( uCluster &cluster ) : uBaseTask( cluster ) {};
+void uRealTimeBaseTask::createRealTimeTask() {
+    release = nextRelease = absDeadline = uTime();
+    missed = false;
+    jobs = misses = 0;
+} // uRealTimeBaseTask::createRealTimeTask
+
+uRealTimeBaseTask::uRealTimeBaseTask( uCluster &cluster ) : uBaseTask( cluster ) {
+    createRealTimeTask();
+} // uRealTimeBaseTask::uRealTimeBaseTask
 
 uRealTimeBaseTask::uRealTimeBaseTask( uTime firstActivateTask_, uTime endTime_, uDuration deadline_, uCluster &cluster ) : uBaseTask( cluster ) {
     if ( deadline_ < 0 ) {
@@ -42,6 +50,7 @@ uRealTimeBaseTask::uRealTimeBaseTask( uTime firstActivateTask_, uTime endTime_,
     firstActivateTime = firstActivateTask_;
     endTime = endTime_;
     deadline = deadline_;
+    createRealTimeTask();
 } // uRealTimeBaseTask::uRealTimeBaseTask
 
 uRealTimeBaseTask::uRealTimeBaseTask( uEvent firstActivateEvent_, uTime endTime_, uDuration deadline_, uCluster &cluster ) : uBaseTask( cluster ) {
@@ -52,6 +61,7 @@ uRealTimeBaseTask::uRealTimeBaseTask( uEvent firstActivateEvent_, uTime endTime_
     firstActivateTime = uTime();
     endTime = endTime_;
     deadline = deadline_;
+    createRealTimeTask();
 } // uRealTimeBaseTask::uRealTimeBaseTask
 
 uRealTimeBaseTask::uRealTimeBaseTask( uTime firstActivateTask_, uEvent firstActivateEvent_, uTime endTime_, uDuration deadline_, uCluster &cluster ) : uBaseTask( cluster ) {
@@ -62,6 +72,7 @@ uRealTimeBaseTask::uRealTimeBaseTask( uTime firstActivateTask_, uEvent firstActi
     firstActivateEvent = firstActivateEvent_;
     endTime = endTime_;
     deadline = deadline_;
+    createRealTimeTask();
 } // uRealTimeBaseTask::uRealTimeBaseTask
 
 uRealTimeBaseTask::~uRealTimeBaseTask() {
@@ -182,18 +193,22 @@ uDuration uPeriodicBaseTask::setPeriod( uDuration period_ ) {
 
 uSporadicBaseTask::uSporadicBaseTask( uDuration frame_, uCluster &cluster ) : uRealTimeBaseTask( uTime(), uTime(), uDuration(), cluster ) {
     frame = frame_;
+    budget = remaining = serverCharged = 0;
 } // uSporadicBaseTask::uSporadicBaseTask
 
 uSporadicBaseTask::uSporadicBaseTask( uDuration frame_, uTime firstActivateTask_, uTime endTime_, uDuration deadline_, uCluster &cluster ) : uRealTimeBaseTask( firstActivateTask_, endTime_, deadline_, cluster ) {
     frame = frame_;
+    budget = remaining = serverCharged = 0;
 } // uSporadicBaseTask::uSporadicBaseTask
 
 uSporadicBaseTask::uSporadicBaseTask( uDuration frame_, uEvent firstActivateEvent_, uTime endTime_, uDuration deadline_, uCluster &cluster ) : uRealTimeBaseTask( firstActivateEvent_, endTime_, deadline_, cluster ) {
     frame = frame_;
+    budget = remaining = serverCharged = 0;
 } // uSporadicBaseTask::uSporadicBaseTask
 
 uSporadicBaseTask::uSporadicBaseTask( uDuration frame_, uTime firstActivateTask_, uEvent firstActivateEvent_, uTime endTime_, uDuration deadline_, uCluster &cluster ) : uRealTimeBaseTask( firstActivateTask_, firstActivateEvent_, endTime_, deadline_, cluster ) {
     frame = frame_;
+    budget = remaining = serverCharged = 0;
 } // uSporadicBaseTask::uSporadicBaseTask
 
 uDuration uSporadicBaseTask::getFrame() const {
@@ -221,6 +236,19 @@ uDuration uSporadicBaseTask::setFrame( uDuration frame_ ) {
     return temp;
 } // uSporadicBaseTask::setFrame
 
+uDuration uSporadicBaseTask::getBudget() const {
+    return budget;
+} // uSporadicBaseTask::getBudget
+
+uDuration uSporadicBaseTask::setBudget( uDuration budget_ ) {
+    if ( budget_ < 0 || budget_ > frame ) {
+	abort( "Attempt to set the budget of task %.256s (%p) outside the range 0..frame.", getName(), this );
+    } // if
+    uDuration temp = budget;
+    budget = remaining = budget_;
+    return temp;
+} // uSporadicBaseTask::setBudget
+
 
 //######################### uRealTimeCluster #########################
 
@@ -251,6 +251,8 @@ template<typename List, typename Node> class uPriorityScheduleSeq : public uPrio
 
 
 class uRealTimeBaseTask : public uBaseTask {
+    friend class uEarliestDeadlineFirst;		// access: job state
+
     class VerCount : public uSeqable {
       public:
 	int version;
@@ -259,6 +261,15 @@ class uRealTimeBaseTask : public uBaseTask {
 
     uDuration deadline;
     uSequence<VerCount> verCountSeq;			// list of scheduler version counts with associated cluster
+
+    // Job state maintained by deadline-driven schedulers at scheduling points.
+    uTime release;					// release time of current job
+    uTime nextRelease;					// earliest release time of next job
+    uTime absDeadline;					// scheduling deadline of current job
+    bool missed;					// current job has missed its deadline
+    unsigned int jobs, misses;
+
+    void createRealTimeTask();
   protected:
     uTime firstActivateTime;
     uEvent firstActivateEvent;
@@ -277,6 +288,9 @@ class uRealTimeBaseTask : public uBaseTask {
 
     virtual int getVersion( uCluster &cluster );
     virtual int setVersion( uCluster &cluster, int version );
+
+    unsigned int getJobs() const { return jobs; }
+    unsigned int getDeadlineMisses() const { return misses; }
 }; // uRealTimeBaseTask
 
 
@@ -300,6 +314,12 @@ class uPeriodicBaseTask : public uRealTimeBaseTask {
 
 
 class uSporadicBaseTask : public uRealTimeBaseTask {
+    friend class uEarliestDeadlineFirst;		// access: server state
+
+    // Constant-bandwidth server state, used by uEarliestDeadlineFirst when a budget is set.
+    uDuration budget;					// server capacity per frame, 0 => no server
+    uDuration remaining;				// capacity remaining before the server deadline is postponed
+    uDuration serverCharged;				// execution time already charged to the server
   protected:
     uDuration frame;
   public:
@@ -309,6 +329,8 @@ class uSporadicBaseTask : public uRealTimeBaseTask {
     uSporadicBaseTask( uDuration frame_, uTime firstActivateTask_, uEvent firstActivateEvent_, uTime endTime_, uDuration deadline_, uCluster &cluster = uThisCluster() );
     uDuration getFrame() const;
     uDuration setFrame( uDuration frame_ );
+    uDuration getBudget() const;
+    uDuration setBudget( uDuration budget_ );
 }; // uSporadicBaseTask
 
 
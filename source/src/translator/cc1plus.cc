@@ -30,10 +30,16 @@ using std::cerr;
 using std::endl;
 #include <string>
 using std::string;
-#include <cstdio>					// stderr, stdout, perror, fprintf
+#include <cstdio>					// stderr, stdout, perror, fprintf, rename
 #include <cstdlib>					// getenv, exit, mkstemp
-#include <unistd.h>					// execvp, fork, unlink
-#include <sys/wait.h>					// wait
+#include <cstring>					// strerror
+#include <cerrno>					// errno
+#include <csignal>					// kill, signal
+#include <fcntl.h>					// open, fcntl
+#include <poll.h>					// poll
+#include <unistd.h>					// execvp, fork, unlink, pipe, dup2
+#include <sys/stat.h>					// stat
+#include <sys/wait.h>					// waitpid
 
 //#define __U_DEBUG_H__
 #include "debug.h"
@@ -43,7 +49,7 @@ string compiler_name( CCAPP );				// path/name of C compiler
 
 string D__U_GCC_BPREFIX__( "-D__U_GCC_BPREFIX__=" );
 
-char tmpname[] = P_tmpdir "/uC++XXXXXX";
+string tmpname;						// partially written cache entry
 int tmpfilefd = -1;
 
 
@@ -78,10 +84,8 @@ void checkEnv( const char * args[] __attribute__(( unused )), int & nargs __attr
 
 
 void rmtmpfile() {
-    if ( unlink( tmpname ) == -1 ) {			// remove tmpname
-	perror ( "uC++ Translator error: cpp failed" );
-	exit( EXIT_FAILURE );
-    } // if
+    close( tmpfilefd );
+    unlink( tmpname.c_str() );				// remove tmpname, failure leaves only a stale cache file
     tmpfilefd = -1;					// mark closed
 } // rmtmpfile
 
@@ -89,11 +93,221 @@ void rmtmpfile() {
 void sigTermHandler( int ) {
     if ( tmpfilefd != -1 ) {				// RACE, file created ?
 	rmtmpfile();					// remove
-	exit( EXIT_FAILURE );				// terminate 
     } // if
+    exit( EXIT_FAILURE );				// terminate
 } // sigTermHandler
 
 
+
+// Wait for a child stage, terminating the compilation if it is killed, and return its exit status.
+
+int waitChild( pid_t pid, const char * name ) {
+    int code;
+    while ( waitpid( pid, &code, 0 ) == -1 && errno == EINTR );
+
+    uDEBUGPRT( cerr << "return code from " << name << ":" << WEXITSTATUS(code) << endl; )
+
+    if ( WIFSIGNALED(code) != 0 ) {			// child failed ?
+	cerr << "uC++ Translator error: " << name << " failed with signal " << WTERMSIG(code) << endl;
+	exit( EXIT_FAILURE );
+    } // if
+    return WEXITSTATUS(code);
+} // waitChild
+
+
+bool writeAll( int fd, const string & buf ) {
+    for ( size_t pos = 0; pos < buf.size(); ) {
+	ssize_t len = write( fd, buf.data() + pos, buf.size() - pos );
+	if ( len == -1 ) {
+	  if ( errno == EINTR ) continue;
+	    return false;
+	} // if
+	pos += len;
+    } // for
+    return true;
+} // writeAll
+
+
+bool writeFile( const char * name, const string & buf ) {
+    if ( name == nullptr ) return writeAll( STDOUT_FILENO, buf );
+    int fd = open( name, O_WRONLY | O_CREAT | O_TRUNC, 0666 );
+  if ( fd == -1 ) return false;
+    bool ok = writeAll( fd, buf );
+    return close( fd ) == 0 && ok;
+} // writeFile
+
+
+bool readFile( const char * name, string & buf ) {
+    int fd = open( name, O_RDONLY );
+  if ( fd == -1 ) return false;
+    char block[65536];
+    for ( ;; ) {
+	ssize_t len = read( fd, block, sizeof(block) );
+	if ( len == -1 ) {
+	  if ( errno == EINTR ) continue;
+	    close( fd );
+	    return false;
+	} // if
+      if ( len == 0 ) break;
+	buf.append( block, len );
+    } // for
+    close( fd );
+    return true;
+} // readFile
+
+
+// 128-bit FNV-1a over the cache key: translator identity, translator flags and preprocessed input.
+
+struct Hash {
+    unsigned __int128 h = ((unsigned __int128)0x6c62272e07bb0142ULL << 64) | 0x62b821756295c58dULL; // offset basis
+
+    void add( const char * buf, size_t len ) {
+	const unsigned __int128 prime = ((unsigned __int128)1 << 88) | 0x13b;
+	for ( size_t i = 0; i < len; i += 1 ) {
+	    h ^= (unsigned char)buf[i];
+	    h *= prime;
+	} // for
+    } // Hash::add
+
+    void add( const string & s ) {
+	add( s.c_str(), s.size() + 1 );			// include terminator to separate fields
+    } // Hash::add
+
+    string hex() const {
+	char buf[33];
+	snprintf( buf, sizeof(buf), "%016llx%016llx", (unsigned long long)(h >> 64), (unsigned long long)h );
+	return buf;
+    } // Hash::hex
+}; // Hash
+
+
+// With a cache directory, the preprocessed input is collected from cpp and hashed, together with the version, size and
+// modification time of u++-cpp and the flags passed to it. On a hit, the cached translation is copied to the output
+// and u++-cpp is not run. On a miss, u++-cpp reads the input and writes its output through pipes, and the output is
+// added to the cache by renaming a completed file, so concurrent builds sharing the cache never see a partial entry.
+// A translation that produces diagnostics is not cached, so warnings are not lost on later builds.
+
+void CachedStage1( int cppfd, pid_t cpppid, const char * uargs[], int nuargs, const char * upp_out, const char * cachedir ) {
+    string input;
+    char block[65536];
+    for ( ;; ) {					// collect preprocessed input
+	ssize_t len = read( cppfd, block, sizeof(block) );
+	if ( len == -1 ) {
+	  if ( errno == EINTR ) continue;
+	    perror( "uC++ Translator error: cpp level, read" );
+	    exit( EXIT_FAILURE );
+	} // if
+      if ( len == 0 ) break;
+	input.append( block, len );
+    } // for
+    close( cppfd );
+    int code = waitChild( cpppid, "cpp" );
+    if ( code != 0 ) exit( code );			// do not continue
+
+    Hash hash;
+    hash.add( VERSION );
+    struct stat sbuf;
+    if ( stat( uargs[0], &sbuf ) == 0 ) {		// rebuilt translator => new entries
+	hash.add( std::to_string( sbuf.st_size ) + ":" + std::to_string( sbuf.st_mtime ) );
+    } // if
+    for ( int i = 1; i < nuargs; i += 1 ) {
+	hash.add( uargs[i] );
+    } // for
+    hash.add( input.data(), input.size() );
+    string entry = string( cachedir ) + "/" + hash.hex() + ".ii";
+    uDEBUGPRT( cerr << "cache entry:" << entry << endl; )
+
+    string output;
+    if ( readFile( entry.c_str(), output ) ) {		// hit ?
+	if ( ! writeFile( upp_out, output ) ) {
+	    perror( "uC++ Translator error: u++-cpp level, write" );
+	    exit( EXIT_FAILURE );
+	} // if
+	exit( EXIT_SUCCESS );
+    } // if
+
+    int in[2], out[2], err[2];
+    if ( pipe( in ) == -1 || pipe( out ) == -1 || pipe( err ) == -1 ) {
+	perror( "uC++ Translator error: u++-cpp level, pipe" );
+	exit( EXIT_FAILURE );
+    } // if
+
+    pid_t upppid = fork();
+    if ( upppid == 0 ) {				// child runs u++-cpp
+	dup2( in[0], STDIN_FILENO );
+	dup2( out[1], STDOUT_FILENO );
+	dup2( err[1], STDERR_FILENO );
+	close( in[0] ); close( in[1] ); close( out[0] ); close( out[1] ); close( err[0] ); close( err[1] );
+	uargs[nuargs] = nullptr;			// stdin to stdout
+	execvp( uargs[0], (char * const *)uargs );	// should not return
+	perror( "uC++ Translator error: u++-cpp level, execvp" );
+	exit( EXIT_FAILURE );
+    } // if
+    close( in[0] ); close( out[1] ); close( err[1] );
+
+    // u++-cpp can write diagnostics while reading its input, so the input is written as the output pipes are drained;
+    // otherwise, a full stderr pipe blocks u++-cpp while cc1plus blocks writing the input.
+    signal( SIGPIPE, SIG_IGN );				// u++-cpp failure is reported by its exit status
+    fcntl( in[1], F_SETFL, O_NONBLOCK );
+    string errors;
+    size_t written = 0;
+    struct pollfd fds[3] = { { out[0], POLLIN, 0 }, { err[0], POLLIN, 0 }, { in[1], POLLOUT, 0 } };
+    if ( input.empty() ) {
+	close( in[1] );
+	fds[2].fd = -1;
+    } // if
+    for ( int active = 2; active > 0; ) {
+	if ( poll( fds, 3, -1 ) == -1 ) {
+	  if ( errno == EINTR ) continue;
+	    perror( "uC++ Translator error: u++-cpp level, poll" );
+	    exit( EXIT_FAILURE );
+	} // if
+	if ( fds[2].fd != -1 && fds[2].revents != 0 ) { // input pipe has space or u++-cpp closed it
+	    ssize_t len = write( fds[2].fd, input.data() + written, input.size() - written );
+	    if ( len > 0 ) written += len;
+	    if ( ( len == -1 && errno != EAGAIN && errno != EINTR ) || written == input.size() ) {
+		close( fds[2].fd );			// EOF for u++-cpp
+		fds[2].fd = -1;
+	    } // if
+	} // if
+	for ( int i = 0; i < 2; i += 1 ) {
+	  if ( fds[i].fd == -1 || fds[i].revents == 0 ) continue;
+	    ssize_t len = read( fds[i].fd, block, sizeof(block) );
+	    if ( len <= 0 ) {
+	      if ( len == -1 && errno == EINTR ) continue;
+		close( fds[i].fd );
+		fds[i].fd = -1;				// poll ignores negative descriptors
+		active -= 1;
+	    } else {
+		(i == 0 ? output : errors).append( block, len );
+	    } // if
+	} // for
+    } // for
+    if ( fds[2].fd != -1 ) close( fds[2].fd );		// u++-cpp terminated before reading all input
+    code = waitChild( upppid, "u++-cpp" );
+    writeAll( STDERR_FILENO, errors );			// pass along diagnostics
+
+    if ( code == 0 && ! writeFile( upp_out, output ) ) {
+	perror( "uC++ Translator error: u++-cpp level, write" );
+	exit( EXIT_FAILURE );
+    } // if
+
+    if ( code == 0 && errors.empty() ) {		// add entry, failure only loses caching
+	tmpname = entry + ".XXXXXX";
+	tmpfilefd = mkstemp( &tmpname[0] );
+	if ( tmpfilefd != -1 ) {
+	    if ( writeAll( tmpfilefd, output ) && close( tmpfilefd ) == 0 ) {
+		tmpfilefd = -1;
+		if ( rename( tmpname.c_str(), entry.c_str() ) == -1 ) unlink( tmpname.c_str() );
+	    } else {
+		rmtmpfile();
+	    } // if
+	} // if
+    } // if
+    exit( code );
+} // CachedStage1
+
+
 void Stage1( const int argc, const char * const argv[] ) {
     int code;
 
@@ -251,26 +465,21 @@ void Stage1( const int argc, const char * const argv[] ) {
 	exit( EXIT_FAILURE );
     } // if
 
-    // Create a temporary file to store output of the C preprocessor.
+    // The C preprocessor writes to a pipe connected to u++-cpp, which reads all of its input before translating. -o
+    // xxx.ii cannot be used to write the output file from cpp because no output file is created if cpp detects an
+    // error (e.g., cannot find include file), whereas output is always generated to stdout.
 
-    tmpfilefd = mkstemp( tmpname );
-    if ( tmpfilefd == -1 ) {
-	perror( "uC++ Translator error: cpp level, mkstemp" );
+    int cppout[2];
+    if ( pipe( cppout ) == -1 ) {
+	perror( "uC++ Translator error: cpp level, pipe" );
 	exit( EXIT_FAILURE );
     } // if
 
-    uDEBUGPRT( cerr << "tmpname:" << tmpname << " tmpfilefd:" << tmpfilefd << endl; )
-
-    // Run the C preprocessor and save the output in tmpfile.
-
-    if ( fork() == 0 ) {				// child process ?
-	// -o xxx.ii cannot be used to write the output file from cpp because no output file is created if cpp detects
-	// an error (e.g., cannot find include file). Whereas, output is always generated, even when there is an error,
-	// when cpp writes to stdout. Hence, stdout is redirected into the temporary file.
-	if ( freopen( tmpname, "w", stdout ) == nullptr ) { // redirect stdout to tmpname
-	    perror( "uC++ Translator error: cpp level, freopen" );
-	    exit( EXIT_FAILURE );
-	} // if
+    pid_t cpppid = fork();
+    if ( cpppid == 0 ) {				// child process ?
+	dup2( cppout[1], STDOUT_FILENO );		// redirect stdout to pipe
+	close( cppout[0] );
+	close( cppout[1] );
 
 #ifdef CLANG	
 	args[0] = "clang++-6.0";
@@ -292,35 +501,29 @@ void Stage1( const int argc, const char * const argv[] ) {
 	perror( "uC++ Translator error: cpp level, execvp" );
 	exit( EXIT_FAILURE );
     } // if
+    close( cppout[1] );
 
-    wait( &code );					// wait for child to finish
-
-    uDEBUGPRT( cerr << "return code from cpp:" << WEXITSTATUS(code) << endl; )
-
-    if ( WIFSIGNALED(code) != 0 ) {			// child failed ?
-	rmtmpfile();					// remove tmpname
-	cerr << "uC++ Translator error: cpp failed with signal " << WTERMSIG(code) << endl;
-	exit( EXIT_FAILURE );
-    } // if
+    uargs[0] = ( *new string( bprefix + "/u++-cpp" ) ).c_str();
+    const char * upp_out = o_name != nullptr ? o_name : ! upp_flag ? cpp_out : nullptr; // nullptr => stdout
 
-    if ( WEXITSTATUS(code) != 0 ) {			// child error ?
-	rmtmpfile();					// remove tmpname
-	exit( WEXITSTATUS( code ) );			// do not continue
+    const char * cachedir = getenv( "__U_CACHE_DIR__" );
+    if ( cachedir != nullptr && *cachedir != '\0' ) {
+	CachedStage1( cppout[0], cpppid, uargs, nuargs, upp_out, cachedir ); // does not return
     } // if
 
-    // If -U++ flag specified, run the u++-cpp preprocessor on the temporary file, and output is written to standard
-    // output.  Otherwise, run the u++-cpp preprocessor on the temporary file and save the result into the output file.
+    // Without a cache, u++-cpp reads directly from cpp.
 
-    if ( fork() == 0 ) {				// child runs CFA
-	uargs[0] = ( *new string( bprefix + "/u++-cpp" ) ).c_str();
-
-	uargs[nuargs++] = tmpname;
-	if ( o_name != nullptr ) {
-	    uargs[nuargs++] = o_name;
-	} else if ( ! upp_flag ) {			// run u++-cpp ?
-	    uargs[nuargs++] = cpp_out;
+    pid_t upppid = fork();
+    if ( upppid == 0 ) {				// child runs u++-cpp
+	dup2( cppout[0], STDIN_FILENO );		// input from cpp
+	close( cppout[0] );
+	if ( upp_out != nullptr ) {
+	    if ( freopen( upp_out, "w", stdout ) == nullptr ) { // redirect stdout to output file
+		perror( "uC++ Translator error: u++-cpp level, freopen" );
+		exit( EXIT_FAILURE );
+	    } // if
 	} // if
-	uargs[nuargs] = nullptr;			// terminate argument list
+	uargs[nuargs] = nullptr;			// no file arguments => u++-cpp reads stdin and writes stdout
 
 	uDEBUGPRT(
 	    cerr << "u++-cpp nuargs: " << o_name << " " << upp_flag << " " << nuargs << endl;
@@ -331,23 +534,18 @@ void Stage1( const int argc, const char * const argv[] ) {
 	)
 
 	execvp( uargs[0], (char * const *)uargs );	// should not return
-	perror( "uC++ Translator error: cpp level, execvp" );
+	perror( "uC++ Translator error: u++-cpp level, execvp" );
 	exit( EXIT_FAILURE );
     } // if
+    close( cppout[0] );
 
-    wait( &code );					// wait for child to finish
-
-    uDEBUGPRT( cerr << "return code from u++-cpp:" << WEXITSTATUS(code) << endl; )
-
-    // Must unlink here because file must exist across execvp.
-    rmtmpfile();					// remove tmpname
-
-    if ( WIFSIGNALED(code) ) {				// child failed ?
-	cerr << "uC++ Translator error: u++-cpp failed with signal " << WTERMSIG(code) << endl;
-	exit( EXIT_FAILURE );
+    code = waitChild( cpppid, "cpp" );
+    if ( code != 0 ) {					// cpp error => translation is meaningless
+	kill( upppid, SIGKILL );
+	waitpid( upppid, nullptr, 0 );
+	exit( code );					// do not continue
     } // if
-
-    exit( WEXITSTATUS(code) );
+    exit( waitChild( upppid, "u++-cpp" ) );
 } // Stage1
 
 
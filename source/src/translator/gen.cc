@@ -218,7 +218,7 @@ void gen_main_prefix( token_t *before, symbol_t *symbol ) {
 		      "uBaseTask :: sleep ( firstActivateTime ) ; "
 		      "if ( endTime == uTime() || uClock :: currTime ( ) < endTime ) { "
 		      "for ( ; ; ) { "
-		      "uTime uStartTime = uClock :: currTime ( ) + getPeriod ( ) ;"
+		      "uTime uStartTime = uClock :: currTime ( ) + getFrame ( ) ;"
 		);
 	} else if ( table->symbol->data->attribute.rttskkind.kind.APERIODIC ) {
 	    gen_code( before,
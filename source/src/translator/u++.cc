@@ -194,6 +194,14 @@ int main( int argc, char * argv[] ) {
 		    cerr << argv[0] << " error, cannot set environment variable." << endl;
 		    exit( EXIT_FAILURE );
 		} // if
+	    } else if ( arg == "-cache" ) {
+		// cache translator output in the specified directory
+		i += 1;
+		if ( i == argc ) continue;		// next argument available ?
+		if ( putenv( (char *)( *new string( string( "__U_CACHE_DIR__=" ) + argv[i]) ).c_str() ) != 0 ) {
+		    cerr << argv[0] << " error, cannot set environment variable." << endl;
+		    exit( EXIT_FAILURE );
+		} // if
 	    } else if ( arg == "-no-u++-include" ) {
 		nouinc = true;
 
@@ -416,10 +424,11 @@ int main( int argc, char * argv[] ) {
 	    } // if
 	} // if
 
-	// override uDefaultProcessors for OpenMP -- must come before uKernel
+	// override uDefaultProcessors for OpenMP and replace libgomp entry points -- must come before uKernel
 
 	if ( openmp ) {
 	    args[nargs++] = ( *new string( installlibdir + "/uDefaultProcessors-OpenMP.o" ) ).c_str();
+	    args[nargs++] = ( *new string( installlibdir + "/uGOMP" + m + d + ".o" ) ).c_str();
 	} // if
 
 	if ( uAlloc != "" ) {